@@ -14,5 +14,86 @@
 // Flow Tap: disable hold during fast typing bursts (QMK May 2025)
 #define FLOW_TAP_TERM 150
 
+// Hold-to-shift on SYMBOLS: a bit under the zen keymap's Auto Shift timeout (220) for
+// the strong fingers, longer for the ring and pinky columns
+#define SL_HOLD_SHIFT_TIMEOUT 200
+#define SL_HOLD_SHIFT_SLOW_EXTRA 40
+
+// Swappers (SW_WIN, SW_TAB, SW_APPW) let go of their modifier after this long without a tap
+#define SWAPPER_IDLE_TIMEOUT 1500
+
+// RP2040 double-tap reset (cantor_pro): every power-up waits out this window before the
+// firmware starts. QMK's default 200 ms instead of the board's 500 ms; a double tap of
+// the reset button has to fit in it
+#ifdef RP2040_BOOTLOADER_DOUBLE_TAP_RESET
+#    undef RP2040_BOOTLOADER_DOUBLE_TAP_RESET_TIMEOUT
+#    define RP2040_BOOTLOADER_DOUBLE_TAP_RESET_TIMEOUT 200U
+#endif
+
 // Combos always reference layer 0 keycodes, so they work regardless of active base layer
 #define COMBO_ONLY_FROM_LAYER 0
+
+// User EEPROM datablock: heatmap counters (features/heatmap.h, HEATMAP_EEPROM_SIZE) from
+// offset 0, then the tunables ring (features/tunables.h, 4 records of 14 bytes) from 512
+#if defined(XC_HEATMAP) || defined(XC_TUNABLES)
+#    define EECONFIG_USER_DATA_SIZE 576
+#    define TUNABLES_EEPROM_OFFSET 512
+#endif
+
+// Tunables: timings read through the per-key callbacks, weak corners through combo_should_trigger()
+#ifdef XC_TUNABLES
+#    define TAPPING_TERM_PER_KEY
+#    define COMBO_TERM_PER_COMBO
+#    ifdef XC_WEAK_CORNERS
+#        define COMBO_SHOULD_TRIGGER
+#    endif
+#endif
+
+// Feature state sync to the slave half (features/split_sync.h), tunables saves copied to
+// the other half's EEPROM (features/tunables.h)
+#ifdef XC_TUNABLES
+#    define SPLIT_TRANSACTION_IDS_USER RPC_ID_USER_STATE, RPC_ID_USER_TUNABLES
+#else
+#    define SPLIT_TRANSACTION_IDS_USER RPC_ID_USER_STATE
+#endif
+
+// Scans per second, reported by telemetry to compare RGB modes
+#ifdef XC_TELEMETRY
+#    define DEBUG_MATRIX_SCAN_RATE
+#endif
+
+// Mouse keys (MOUSE layer): kinetic curve, the cursor speeds up the longer a key is held.
+// Speeds are in px/s from INITIAL_SPEED to BASE_SPEED; Prc (MS_ACL0) and Fst (MS_ACL2)
+// switch to a fixed precise or fast speed while held. mousekey_task() folds the cursor and
+// wheel steps due in one pass into a single report; cursor steps come every MOUSEKEY_INTERVAL.
+#define MK_KINETIC_SPEED
+#ifndef MOUSEKEY_INTERVAL
+#    define MOUSEKEY_INTERVAL 8  // ms between cursor reports (125 Hz)
+#endif
+#ifndef MOUSEKEY_MOVE_DELTA
+#    define MOUSEKEY_MOVE_DELTA 8  // px per report before acceleration
+#endif
+#ifndef MOUSEKEY_INITIAL_SPEED
+#    define MOUSEKEY_INITIAL_SPEED 100
+#endif
+#ifndef MOUSEKEY_BASE_SPEED
+#    define MOUSEKEY_BASE_SPEED 4000
+#endif
+#ifndef MOUSEKEY_DECELERATED_SPEED
+#    define MOUSEKEY_DECELERATED_SPEED 300
+#endif
+#ifndef MOUSEKEY_ACCELERATED_SPEED
+#    define MOUSEKEY_ACCELERATED_SPEED 6000
+#endif
+#ifndef MOUSEKEY_WHEEL_INITIAL_MOVEMENTS
+#    define MOUSEKEY_WHEEL_INITIAL_MOVEMENTS 16  // wheel steps per second, ramping to BASE
+#endif
+#ifndef MOUSEKEY_WHEEL_BASE_MOVEMENTS
+#    define MOUSEKEY_WHEEL_BASE_MOVEMENTS 32
+#endif
+#ifndef MOUSEKEY_WHEEL_DECELERATED_MOVEMENTS
+#    define MOUSEKEY_WHEEL_DECELERATED_MOVEMENTS 8
+#endif
+#ifndef MOUSEKEY_WHEEL_ACCELERATED_MOVEMENTS
+#    define MOUSEKEY_WHEEL_ACCELERATED_MOVEMENTS 48
+#endif
@@ -2,31 +2,14 @@
 
 #include "quantum.h"
 
-// Token concatenation helper macros for custom keycodes
-#define X_CONCAT_IMPL(a, b) a ## b
-#define X_CONCAT(a, b) X_CONCAT_IMPL(a, b)
-
-#define LIST_START_MARKER(PREFIX) X_CONCAT(X_CONCAT(_, PREFIX), _START)
-#define LIST_LENGTH(PREFIX) X_CONCAT(X_CONCAT(_, PREFIX), _COUNT)
-
-#define CUSTOM_KEYCODES(PREFIX, ...) \
-    LIST_START_MARKER(PREFIX), \
-    X_FIRST(__VA_ARGS__), \
-    X_REST(__VA_ARGS__), \
-    LIST_LENGTH(PREFIX)
-
-// Helper macros to extract first and rest of arguments
-#define X_FIRST(first, ...) first
-#define X_REST(first, ...) __VA_ARGS__
-
-#include "features/semantic_keys.h"
-#include "features/dead_keys.h"
-#include "features/alt_symbols.h"
-#include "features/alt_symbols_layer.h"
+// Shared features and their keycodes (users/xcambar)
+#include "xcambar.h"
 
 // Custom keycodes for the xavier keymap
 enum custom_keycodes {
-    SW_WIN = SAFE_RANGE,     // Switch window (cmd-tab)
+    SW_WIN = XC_SAFE_RANGE,  // Switch window (Cmd-Tab / Alt-Tab)
+    SW_TAB,                  // Switch tab (Ctrl-Tab)
+    SW_APPW,                 // Switch window of the same app (Cmd-` / Alt-`)
     MM_GUICTRL,              // Modifier swappable between GUI and Ctrl
     SEL_LATCH,               // Shift latch scoped to the FAVS layer (tap to toggle)
     MD_FENCE,                // Markdown code fence: types ```
@@ -35,18 +18,9 @@ enum custom_keycodes {
     PR_OS,                   // Type the current OS platform name
     SW_LYT,                  // Toggle default base layout (primary/secondary)
     PR_LYT,                  // Type the current layout name
-
-    // Semantic keys (expanded from SEMANTIC_KEYS_LIST macro)
-    SEMANTIC_KEYS_LIST,
-
-    // Dead keys (expanded from DEAD_KEYS_LIST macro)
-    DEAD_KEYS_LIST,
-
-#ifdef XC_ALT_BASE_SYMBOLS
-    // Alternative symbols (expanded from ALT_SYMBOLS_LIST macro)
-    ALT_SYMBOLS_LIST,
-#endif
-
-    // Alternative symbols layer (expanded from ALT_SYMBOLS_LAYER_LIST macro)
-    ALT_SYMBOLS_LAYER_LIST,
+    CNT_PFX,                 // Arm a Vim-style count for the next motion/deletion
+    NW_TOGG,                 // Num Word: numbers layer until the first non-numeric key
+    CASE_MD,                 // Case mode picker: snake_case, kebab-case, path/case, camelCase
+    MR_REC,                  // Macro recorder: start/stop recording (Shift: slot 2)
+    MR_PLY,                  // Macro recorder: replay slot 1 (Shift: slot 2), after a count: N times
 };
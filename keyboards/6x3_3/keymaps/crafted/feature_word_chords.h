@@ -0,0 +1,30 @@
+// Word Chords Dictionary
+// Whole words typed by pressing several alpha keys together (see features/word_chords.h)
+//
+// When XC_WORD_CHORDS is enabled:
+//   - Chords are keyed by abstract positions (CHORD_POS(_XX_ index)), not by letters,
+//     so the mnemonics below assume the default Gallium East base layer
+//   - Entries MUST stay sorted by their bitmask (ascending): lookup is a binary search.
+//     The hex value in each comment is the mask, to make insertion easy
+//   - Avoid the weak-corner combo pairs (02+03, 08+09, 27+28, 31+32): the combo
+//     fires before the chord can see its keys
+//   - Mod-tap positions (16, 19, 26-28, 31-33) tap inside a typing burst thanks to
+//     Flow Tap, but a chord starting from rest may resolve them as holds
+
+#pragma once
+
+#ifdef XC_WORD_CHORDS
+    const word_chord_t word_chords[] PROGMEM = {
+        WORD_CHORD(CHORD_POS(8)  | CHORD_POS(13),                                 "not"),       // 0x2100     O N
+        WORD_CHORD(CHORD_POS(3)  | CHORD_POS(7)  | CHORD_POS(9)  | CHORD_POS(13), "function"),  // 0x2288     C F U N
+        WORD_CHORD(CHORD_POS(7)  | CHORD_POS(8)  | CHORD_POS(14),                 "for"),       // 0x4180     F O R
+        WORD_CHORD(CHORD_POS(3)  | CHORD_POS(8)  | CHORD_POS(13) | CHORD_POS(15), "const"),     // 0xa108     C O N S
+        WORD_CHORD(CHORD_POS(9)  | CHORD_POS(18),                                 "you"),       // 0x40200    U Y
+        WORD_CHORD(CHORD_POS(9)  | CHORD_POS(13) | CHORD_POS(14) | CHORD_POS(20), "return"),    // 0x106200   U N R E
+        WORD_CHORD(CHORD_POS(16) | CHORD_POS(19) | CHORD_POS(20),                 "the"),       // 0x190000   T H E
+        WORD_CHORD(CHORD_POS(4)  | CHORD_POS(13) | CHORD_POS(21),                 "and"),       // 0x202010   D N A
+        WORD_CHORD(CHORD_POS(16) | CHORD_POS(19) | CHORD_POS(21),                 "that"),      // 0x290000   T H A
+        WORD_CHORD(CHORD_POS(14) | CHORD_POS(20) | CHORD_POS(21),                 "are"),       // 0x304000   R E A
+    };
+    const uint16_t word_chords_count = ARRAY_SIZE(word_chords);
+#endif
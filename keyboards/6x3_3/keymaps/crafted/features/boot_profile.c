@@ -0,0 +1,76 @@
+#include QMK_KEYBOARD_H
+#include "usb_device_state.h"
+#include "boot_profile.h"
+
+/*
+ * Boot Profile - Boot-phase timestamps and deferred initialization
+ *
+ * A phase reached at timer 0 is stored as 1 ms, so 0 keeps meaning "not reached".
+ */
+
+static uint32_t phase_time[BOOT_PHASE_COUNT];
+static bool     deferred_done = false;
+
+__attribute__((weak)) void keyboard_deferred_init_user(void) {}
+
+// Console output only: without CONSOLE_ENABLE uprintf() compiles to nothing
+#ifdef CONSOLE_ENABLE
+static const char *const phase_names[BOOT_PHASE_COUNT] = {
+    [BOOT_PHASE_PRE_INIT]  = "pre_init",
+    [BOOT_PHASE_POST_INIT] = "post_init",
+    [BOOT_PHASE_USB_READY] = "usb",
+    [BOOT_PHASE_DEFERRED]  = "deferred",
+    [BOOT_PHASE_FIRST_KEY] = "first_key",
+};
+
+static void boot_profile_print(void) {
+    uprintf("boot:");
+    for (uint8_t phase = 0; phase < BOOT_PHASE_COUNT; phase++) {
+        if (phase_time[phase]) {
+            uprintf(" %s=%lu", phase_names[phase], (unsigned long)phase_time[phase]);
+        }
+    }
+    uprintf(" ms\n");
+}
+#endif
+
+// Timestamp a phase (the first mark wins)
+void boot_profile_mark(boot_phase_t phase) {
+    if (phase < BOOT_PHASE_COUNT && !phase_time[phase]) {
+        uint32_t now      = timer_read32();
+        phase_time[phase] = now ? now : 1;
+    }
+}
+
+// Timestamp the first key press
+bool process_boot_profile(uint16_t keycode, keyrecord_t *record) {
+    if (record->event.pressed && !phase_time[BOOT_PHASE_FIRST_KEY]) {
+        boot_profile_mark(BOOT_PHASE_FIRST_KEY);
+#ifdef CONSOLE_ENABLE
+        boot_profile_print();  // by now a console listener has had time to attach
+#endif
+    }
+    return true;
+}
+
+// Run the deferred init when due
+void boot_profile_task(void) {
+    if (deferred_done) {
+        return;
+    }
+    if (is_keyboard_master()) {
+        if (usb_device_state.configure_state == USB_DEVICE_STATE_CONFIGURED) {
+            boot_profile_mark(BOOT_PHASE_USB_READY);
+        } else if (timer_elapsed32(phase_time[BOOT_PHASE_POST_INIT]) < BOOT_DEFER_TIMEOUT) {
+            return;  // enumeration still in progress: keep the main loop free for it
+        }
+    }
+    deferred_done = true;
+    keyboard_deferred_init_user();
+    boot_profile_mark(BOOT_PHASE_DEFERRED);
+}
+
+// Phase timestamps in ms, 0 = not reached
+const uint32_t *get_boot_profile(void) {
+    return phase_time;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Boot Profile - Boot-phase timestamps and deferred initialization
+ *
+ * Records when each boot phase is reached, in ms since the keyboard timer started
+ * (the RP2040 double-tap reset window runs before that and is not included):
+ * keyboard_pre_init_user, keyboard_post_init_user, USB configured, deferred init
+ * done, first key press. Once the first key is in, the timeline is printed over the
+ * console; Host Link also reads it (tools/xc_ctl.py boot).
+ *
+ * Initialization that nothing needs to send the first keystroke (RGB startup, EEPROM
+ * counters...) goes in keyboard_deferred_init_user(), run once from housekeeping
+ * after the host has configured the USB device, so enumeration is not kept waiting.
+ * The slave half, and a master that never gets configured (power-only cable), run it
+ * after BOOT_DEFER_TIMEOUT instead of waiting for USB.
+ *
+ * Usage in keymap.c:
+ * 1. boot_profile.c in SRC (rules.mk)
+ * 2. Call boot_profile_mark() from keyboard_pre_init_user() and keyboard_post_init_user()
+ *    with the matching phase
+ * 3. Call process_boot_profile() from process_record_user() and boot_profile_task()
+ *    from housekeeping_task_user()
+ * 4. Implement keyboard_deferred_init_user()
+ */
+
+#ifndef BOOT_DEFER_TIMEOUT
+#    define BOOT_DEFER_TIMEOUT 1000  // ms after post-init to stop waiting for USB
+#endif
+
+typedef enum {
+    BOOT_PHASE_PRE_INIT,   // keyboard_pre_init_user()
+    BOOT_PHASE_POST_INIT,  // keyboard_post_init_user()
+    BOOT_PHASE_USB_READY,  // first housekeeping pass with USB configured (master only)
+    BOOT_PHASE_DEFERRED,   // keyboard_deferred_init_user() returned
+    BOOT_PHASE_FIRST_KEY,  // first key press processed
+    BOOT_PHASE_COUNT,
+} boot_phase_t;
+
+// To be implemented by the consumer: non-critical initialization
+void keyboard_deferred_init_user(void);
+
+// Timestamp a phase (the first mark wins)
+void boot_profile_mark(boot_phase_t phase);
+
+// Timestamp the first key press - call from process_record_user()
+bool process_boot_profile(uint16_t keycode, keyrecord_t *record);
+
+// Run the deferred init when due - call from housekeeping_task_user()
+void boot_profile_task(void);
+
+// Phase timestamps in ms, BOOT_PHASE_COUNT of them, 0 = not reached
+const uint32_t *get_boot_profile(void);
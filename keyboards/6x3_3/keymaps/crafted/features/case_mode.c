@@ -0,0 +1,141 @@
+#include QMK_KEYBOARD_H
+#include "../custom_keycodes.h"
+#include "case_mode.h"
+
+/*
+ * Case Mode - snake_case, kebab-case, path/case and camelCase while typing
+ *
+ * Two-step state: CASE_MD arms the mode picker, the next key selects the mode.
+ * Once active, Space is rewritten until a word-breaking key (or a double Space).
+ */
+
+static bool        case_mode_selecting = false;
+static case_mode_t case_mode           = CASE_MODE_OFF;
+static bool        case_mode_after_sep = false;  // last key was a rewritten Space
+
+// Separator typed in place of Space (camelCase has none)
+static const uint16_t case_mode_separators[] = {
+    [CASE_MODE_OFF]   = KC_NO,
+    [CASE_MODE_SNAKE] = KC_UNDS,
+    [CASE_MODE_KEBAB] = KC_MINS,
+    [CASE_MODE_SLASH] = KC_SLSH,
+    [CASE_MODE_CAMEL] = KC_NO,
+};
+
+case_mode_t get_case_mode(void) {
+    return case_mode;
+}
+
+void case_mode_off(void) {
+    case_mode_selecting = false;
+    if (case_mode != CASE_MODE_OFF) {
+        case_mode = CASE_MODE_OFF;
+        // The identifier is done: a combined Caps Word ends with it
+        caps_word_off();
+    }
+}
+
+static case_mode_t case_mode_for_key(uint16_t keycode) {
+    switch (keycode) {
+        case KC_S:
+        case KC_UNDS:
+#ifdef XC_ALT_BASE_SYMBOLS
+        case AS_UNDS:
+#endif
+            return CASE_MODE_SNAKE;
+        case KC_K:
+        case KC_MINS:
+#ifdef XC_ALT_BASE_SYMBOLS
+        case AS_MINS:
+#endif
+            return CASE_MODE_KEBAB;
+        case KC_P:
+        case KC_SLSH:
+            return CASE_MODE_SLASH;
+        case KC_C:
+            return CASE_MODE_CAMEL;
+        default:
+            return CASE_MODE_OFF;
+    }
+}
+
+// Process case mode - call from process_record_user()
+bool process_case_mode(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == CASE_MD) {
+        if (record->event.pressed) {
+            if (case_mode != CASE_MODE_OFF) {
+                case_mode_off();
+            } else {
+                case_mode_selecting = true;
+            }
+        }
+        return false;
+    }
+
+    if ((!case_mode_selecting && case_mode == CASE_MODE_OFF) || !record->event.pressed) {
+        return true;
+    }
+
+    uint16_t kc = keycode;
+    if (IS_QK_MOD_TAP(keycode)) {
+        if (record->tap.count == 0) {
+            return true;  // mod-tap held as modifier
+        }
+        kc = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    }
+    switch (kc) {
+        case KC_LCTL ... KC_RGUI:
+        case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+        case QK_LAYER_LOCK:
+            return true;  // modifiers and layer keys don't affect the mode
+        default:
+            break;
+    }
+
+    // Mode picker: the key right after CASE_MD
+    if (case_mode_selecting) {
+        case_mode_selecting = false;
+        if (kc == KC_ESC) {
+            return false;  // cancel
+        }
+        case_mode           = case_mode_for_key(kc);
+        case_mode_after_sep = false;
+        return case_mode == CASE_MODE_OFF;  // unknown key: pass through unchanged
+    }
+
+    if (kc == KC_SPC) {
+        if (case_mode_after_sep) {
+            // Double Space: drop the separator we just typed, type a real Space, done
+            if (case_mode != CASE_MODE_CAMEL) {
+                tap_code(KC_BSPC);
+            }
+            case_mode_off();
+            tap_code(KC_SPC);
+        } else {
+            uint16_t sep = case_mode_separators[case_mode];
+            if (sep != KC_NO) {
+                tap_code16(sep);
+            }
+            case_mode_after_sep = true;
+        }
+        return false;
+    }
+
+    switch (word_key_class(kc)) {
+        case WORD_KEY_LETTER:
+            if (case_mode == CASE_MODE_CAMEL && case_mode_after_sep && kc >= KC_A && kc <= KC_Z) {
+                case_mode_after_sep = false;
+                tap_code16(LSFT(kc));
+                return false;
+            }
+            case_mode_after_sep = false;
+            return true;
+        case WORD_KEY_CONTINUE:
+            case_mode_after_sep = false;
+            return true;
+        default:
+            // Word boundary (punctuation, Enter, Esc, ...): the identifier is finished
+            case_mode_off();
+            return true;
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Case Mode - snake_case, kebab-case, path/case and camelCase while typing
+ *
+ * Tap CASE_MD, then pick the mode with the next key:
+ *   S or _  → snake_case     K or -  → kebab-case
+ *   P       → path/case      C       → camelCase
+ *   Esc cancels; any other key cancels and passes through unchanged.
+ * While a mode is active, Space types the separator (camelCase: capitalizes the
+ * next letter). Two Spaces in a row end the mode and type a real Space; any other
+ * word-breaking key ends it and passes through. Combine with Caps Word for
+ * SCREAMING_SNAKE / SCREAMING-KEBAB.
+ *
+ * Word boundaries come from word_key_class(), the same classifier that drives
+ * caps_word_press_user(), so both features agree on what continues a word.
+ *
+ * Usage in keymap.c:
+ * 1. Add case_mode.c to SRC in rules.mk
+ * 2. Call process_case_mode() in process_record_user()
+ * 3. Implement word_key_class() and use it from caps_word_press_user()
+ */
+
+typedef enum {
+    CASE_MODE_OFF = 0,
+    CASE_MODE_SNAKE,
+    CASE_MODE_KEBAB,
+    CASE_MODE_SLASH,
+    CASE_MODE_CAMEL,
+} case_mode_t;
+
+// Word-boundary classes shared by Caps Word and Case Mode
+typedef enum {
+    WORD_KEY_BREAK = 0,  // ends the word
+    WORD_KEY_LETTER,     // part of the word, shifted by Caps Word
+    WORD_KEY_CONTINUE,   // part of the word, never shifted (digits, _, Backspace)
+} word_key_t;
+
+// Process case mode - call from process_record_user()
+// Returns true to continue processing, false if handled
+bool process_case_mode(uint16_t keycode, keyrecord_t *record);
+
+case_mode_t get_case_mode(void);
+void        case_mode_off(void);
+
+// To be implemented by the consumer. Classifies a keycode for word boundaries
+// (receives the tap keycode for mod-taps). Space must be WORD_KEY_CONTINUE while
+// a case mode is active so that Caps Word survives the separator.
+word_key_t word_key_class(uint16_t keycode);
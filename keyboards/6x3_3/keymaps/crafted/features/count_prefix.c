@@ -0,0 +1,93 @@
+#include QMK_KEYBOARD_H
+#include "../custom_keycodes.h"
+#include "count_prefix.h"
+#include "output_queue.h"
+#include "semantic_keys.h"
+
+/*
+ * Count Prefix - Vim-style repeat counts for motions and deletions
+ *
+ * Operator-pending state: armed by CNT_PFX, fed by digits, resolved by the
+ * first motion (arrows, pages, Backspace/Delete, any semantic key).
+ */
+
+static bool    count_pending = false;
+static uint8_t count_value   = 0;
+
+__attribute__((weak)) bool count_prefix_user(uint16_t keycode, uint8_t count) {
+    return false;
+}
+
+bool is_count_prefix_pending(void) {
+    return count_pending;
+}
+
+// Keys that can be repeated by a count: FAVS motions and NAV_DEL deletions
+static bool is_countable(uint16_t keycode) {
+    switch (keycode) {
+        case KC_LEFT:
+        case KC_RGHT:
+        case KC_UP:
+        case KC_DOWN:
+        case KC_PGUP:
+        case KC_PGDN:
+        case KC_BSPC:
+        case KC_DEL:
+            return true;
+        default:
+            return is_semkey(keycode);
+    }
+}
+
+// Process count prefix - call from process_record_user() BEFORE process_semkey()
+bool process_count_prefix(uint16_t keycode, keyrecord_t *record) {
+    if (keycode == CNT_PFX) {
+        if (record->event.pressed) {
+            count_pending = true;
+            count_value   = 0;
+        }
+        return false;
+    }
+
+    if (!count_pending || !record->event.pressed) {
+        return true;
+    }
+
+    uint16_t kc = keycode;
+    if (IS_QK_MOD_TAP(keycode)) {
+        if (record->tap.count == 0) {
+            return true;  // mod-tap held as modifier: keep the count pending
+        }
+        kc = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    }
+    if (IS_QK_MOMENTARY(kc) || kc == QK_LAYER_LOCK) {
+        return true;  // reaching FAVS / NAV_DEL doesn't consume the count
+    }
+
+    switch (kc) {
+        case KC_LCTL ... KC_RGUI:
+            return true;  // plain modifiers don't consume the count (allows shifted motions)
+        case KC_1 ... KC_9:
+        case KC_0: {
+            uint8_t digit = (kc == KC_0) ? 0 : (kc - KC_1 + 1);
+            uint16_t next = count_value * 10 + digit;
+            count_value   = (next > COUNT_PREFIX_MAX) ? COUNT_PREFIX_MAX : next;
+            return false;
+        }
+        case KC_ESC:
+            count_pending = false;
+            return false;  // cancel
+        default: {
+            count_pending = false;
+            // A bare CNT_PFX with no digits behaves as a count of one
+            uint8_t count = count_value ? count_value : 1;
+            if (!is_countable(kc)) {
+                return !count_prefix_user(kc, count);  // pass through unchanged, unless repeated
+            }
+            if (!output_queue_push(kc, count)) {
+                return false;  // queue full: the motion is dropped rather than run uncounted
+            }
+            return false;
+        }
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Count Prefix - Vim-style repeat counts for motions and deletions
+ *
+ * Tap CNT_PFX, type a count on the SYMBOLS numpad, then press a FAVS motion or a
+ * NAV_DEL deletion: the motion is emitted `count` times as a single batch through
+ * the output queue. The keymap flushes the queue before each key press, so a count
+ * always fits; should it not, the motion is dropped, never run uncounted. Like Compose,
+ * the pending state is consumed by the next key:
+ * - digits accumulate into the count (capped at COUNT_PREFIX_MAX)
+ * - modifiers and layer keys (MO, Layer Lock) pass through without consuming it
+ * - Esc cancels
+ * - any other key cancels and passes through unchanged, unless count_prefix_user()
+ *   repeats it (e.g. a macro replay)
+ *
+ * Usage in keymap.c:
+ * 1. Add count_prefix.c and output_queue.c to SRC in rules.mk
+ * 2. Call process_count_prefix() in process_record_user() BEFORE process_semkey()
+ */
+
+#ifndef COUNT_PREFIX_MAX
+#    define COUNT_PREFIX_MAX 99
+#endif
+
+// Process count prefix - call from process_record_user() BEFORE process_semkey()
+// Returns true to continue processing, false if handled
+bool process_count_prefix(uint16_t keycode, keyrecord_t *record);
+
+// True while a count is being typed (armed, waiting for a motion)
+bool is_count_prefix_pending(void);
+
+// To be implemented by the consumer (optional). Receives the count and the key that
+// ended it when that key is not a motion; returns true when it repeated the key itself.
+bool count_prefix_user(uint16_t keycode, uint8_t count);
@@ -0,0 +1,152 @@
+#include QMK_KEYBOARD_H
+#include "debounce.h"
+#include "eager_debounce.h"
+
+/*
+ * Eager Debounce - Asymmetric per-key debounce: eager press, deferred release
+ *
+ * Key state byte: bits 0-5 count down the milliseconds left in the current phase,
+ * bit 6 marks a press lockout (contacts ignored), bit 7 a pending release (contacts
+ * must stay open until the countdown ends). Both clear means the key is settled and
+ * its cooked state matches the contacts.
+ */
+
+#define KEY_COUNTDOWN_MASK 0x3F
+#define KEY_LOCKOUT        0x40
+#define KEY_RELEASING      0x80
+
+_Static_assert(DEBOUNCE <= KEY_COUNTDOWN_MASK, "DEBOUNCE must fit the 6-bit countdown");
+
+static uint8_t          key_state[MATRIX_ROWS][MATRIX_COLS];
+static uint16_t         edge_time[MATRIX_ROWS][MATRIX_COLS];     // first raw edge of the pending release
+static uint16_t         release_time[MATRIX_ROWS][MATRIX_COLS];  // last reported release
+static matrix_row_t     last_raw[MATRIX_ROWS];
+static uint16_t         last_time = 0;
+static bool             settling  = false;  // some key has a countdown running
+static debounce_stats_t stats;
+
+static inline void bump8(uint8_t *counter) {
+    if (*counter < UINT8_MAX) {
+        (*counter)++;
+    }
+}
+
+static void record_latency(uint16_t since, uint8_t *max, uint32_t *sum, uint32_t *count) {
+    uint16_t latency = timer_elapsed(since);
+    if (latency > UINT8_MAX) {
+        latency = UINT8_MAX;
+    }
+    if (latency > *max) {
+        *max = latency;
+    }
+    *sum += latency;
+    (*count)++;
+}
+
+void debounce_init(uint8_t num_rows) {
+    memset(key_state, 0, sizeof(key_state));
+    memset(last_raw, 0, sizeof(last_raw));
+    debounce_stats_reset();
+    last_time = timer_read();
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    uint16_t now     = timer_read();
+    uint16_t elapsed = TIMER_DIFF_16(now, last_time);
+    if (!changed && (!settling || elapsed == 0)) {
+        return false;  // nothing moved and no countdown to advance
+    }
+    last_time = now;
+    if (elapsed > KEY_COUNTDOWN_MASK) {
+        elapsed = KEY_COUNTDOWN_MASK;
+    }
+
+    bool cooked_changed = false;
+    settling            = false;
+    for (uint8_t row = 0; row < num_rows && row < MATRIX_ROWS; row++) {
+        matrix_row_t delta = raw[row] ^ cooked[row];
+        matrix_row_t flips = raw[row] ^ last_raw[row];
+        last_raw[row]      = raw[row];
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            matrix_row_t bit   = MATRIX_ROW_SHIFTER << col;
+            uint8_t     *state = &key_state[row][col];
+            bool         down  = raw[row] & bit;
+
+            if (*state) {
+                // Settling: advance the countdown, watch the contacts
+                uint8_t countdown = *state & KEY_COUNTDOWN_MASK;
+                countdown         = countdown > elapsed ? countdown - elapsed : 0;
+                if (flips & bit) {
+                    stats.bounces++;
+                }
+
+                if (*state & KEY_RELEASING) {
+                    if (down) {
+                        *state = 0;  // closed again before the release settled: still pressed
+                        continue;
+                    }
+                    if (countdown == 0) {
+                        cooked[row] &= ~bit;
+                        cooked_changed         = true;
+                        release_time[row][col] = now;
+                        record_latency(edge_time[row][col], &stats.release_latency_max, &stats.release_latency_sum, &stats.release_count);
+                        *state = 0;
+                        continue;
+                    }
+                } else {  // press lockout
+                    if ((flips & bit) && !down) {
+                        edge_time[row][col] = now;  // latest opening: the release edge if they stay open
+                    }
+                    if (countdown == 0) {
+                        *state = 0;
+                        if (!down) {
+                            // Opened during the lockout: it has to settle like any release
+                            *state   = KEY_RELEASING | DEBOUNCE;
+                            settling = true;
+                        }
+                        continue;
+                    }
+                }
+                *state   = (*state & ~KEY_COUNTDOWN_MASK) | countdown;
+                settling = true;
+                continue;
+            }
+
+            if (!(delta & bit)) {
+                continue;  // settled and unchanged
+            }
+
+            if (down) {
+                // Eager press: reported on the scan that saw the edge, then the bounce is ignored
+                cooked[row] |= bit;
+                cooked_changed = true;
+                stats.press_count++;
+                if (TIMER_DIFF_16(now, release_time[row][col]) < DEBOUNCE_CHATTER_WINDOW) {
+                    bump8(&stats.chatter[row][col]);
+                }
+                *state = KEY_LOCKOUT | DEBOUNCE;
+            } else {
+                // Deferred release: wait for the contacts to stay open
+                edge_time[row][col] = now;
+                *state              = KEY_RELEASING | DEBOUNCE;
+            }
+            settling = true;
+        }
+    }
+    return cooked_changed;
+}
+
+// Instrumentation counters
+const debounce_stats_t *get_debounce_stats(void) {
+    return &stats;
+}
+
+// Clear the instrumentation counters
+void debounce_stats_reset(void) {
+    memset(&stats, 0, sizeof(stats));
+    stats.debounce_ms = DEBOUNCE;
+    stats.rows        = MATRIX_ROWS;
+    stats.cols        = MATRIX_COLS;
+    // Old release times would count the first press after a reset as chatter
+    memset(release_time, 0, sizeof(release_time));
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Eager Debounce - Asymmetric per-key debounce: eager press, deferred release
+ *
+ * Replaces QMK's stock debounce (DEBOUNCE_TYPE = custom). A press is reported on
+ * the first scan that sees it, then the key ignores its contacts for DEBOUNCE ms
+ * while they bounce. A release is only reported once the contacts have read open
+ * for DEBOUNCE ms in a row, so a bounce on release can't produce a phantom press.
+ * Keys are independent: one key bouncing never delays another.
+ *
+ * Per-key state is one byte: a millisecond countdown and two phase bits.
+ *
+ * Instrumentation (read through Host Link, see tools/xc_telemetry.py --debounce):
+ * - release latency, from the raw edge to the reported release (DEBOUNCE after the
+ *   contacts last opened). Presses are only counted: one is reported on the scan that
+ *   sees its edge, so there is no earlier timestamp to measure from
+ * - bounces absorbed (raw flips while a key was settling)
+ * - chatter per key: a press reported within DEBOUNCE_CHATTER_WINDOW of the same
+ *   key's release, i.e. a bounce the filter let through
+ * Each half measures its own keys; the host sees the half it is plugged into.
+ *
+ * Usage in rules.mk:
+ * 1. DEBOUNCE_TYPE = custom and eager_debounce.c in SRC
+ * 2. DEBOUNCE (config.h) sets both the press lockout and the release delay
+ */
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+#ifndef DEBOUNCE_CHATTER_WINDOW
+#    define DEBOUNCE_CHATTER_WINDOW 30  // ms: a re-press this soon after a release is chatter
+#endif
+
+// Fields are ordered so the struct has no padding: the host decodes it as laid out here
+typedef struct {
+    uint8_t  debounce_ms;          // DEBOUNCE
+    uint8_t  rows;                 // MATRIX_ROWS
+    uint8_t  cols;                 // MATRIX_COLS
+    uint8_t  release_latency_max;  // ms
+    uint32_t press_count;
+    uint32_t release_latency_sum;  // ms, over release_count releases
+    uint32_t release_count;
+    uint32_t bounces;
+    uint8_t  chatter[MATRIX_ROWS][MATRIX_COLS];  // saturating, per matrix position
+} debounce_stats_t;
+
+// Instrumentation counters
+const debounce_stats_t *get_debounce_stats(void);
+
+// Clear the instrumentation counters
+void debounce_stats_reset(void);
@@ -0,0 +1,108 @@
+#include QMK_KEYBOARD_H
+#include <hal.h>
+#include "edge_matrix.h"
+
+/*
+ * Edge Matrix - Interrupt-assisted scanning for direct-pin matrices (ChibiOS)
+ *
+ * The interrupt handler only sets edge_pending and, for the first edge since the
+ * last read, edge_time (ChibiOS system time, ISR-safe). The scan clears the flag
+ * before reading the pins, so an edge that lands during the read is picked up by
+ * the next scan instead of being lost.
+ *
+ * Like quantum/matrix.c, each half fills rows 0..ROWS_PER_HAND-1: the split matrix
+ * code debounces those and places them in the full matrix itself.
+ */
+
+#if !defined(DIRECT_PINS)
+#    error "XC_EDGE_MATRIX needs a direct-pin matrix (DIRECT_PINS)"
+#endif
+
+static pin_t direct_pins[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS;
+#ifdef DIRECT_PINS_RIGHT
+static const pin_t direct_pins_right[ROWS_PER_HAND][MATRIX_COLS] = DIRECT_PINS_RIGHT;
+#endif
+
+static volatile bool       edge_pending = true;  // read once at startup
+static volatile systime_t  edge_time;
+static uint32_t            last_read = 0;
+static edge_matrix_stats_t stats;
+
+static void edge_callback(void *arg) {
+    chSysLockFromISR();
+    if (!edge_pending) {
+        edge_time    = chVTGetSystemTimeX();
+        edge_pending = true;
+    }
+    chSysUnlockFromISR();
+}
+
+void matrix_init_custom(void) {
+#if defined(SPLIT_KEYBOARD) && defined(DIRECT_PINS_RIGHT)
+    if (!is_keyboard_left()) {
+        memcpy(direct_pins, direct_pins_right, sizeof(direct_pins));
+    }
+#endif
+
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            pin_t pin = direct_pins[row][col];
+            if (pin == NO_PIN) {
+                continue;
+            }
+            gpio_set_pin_input_high(pin);
+            palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+            palSetLineCallback(pin, edge_callback, NULL);
+        }
+    }
+    edge_matrix_stats_reset();
+    edge_time = chVTGetSystemTimeX();
+}
+
+bool matrix_scan_custom(matrix_row_t current_matrix[]) {
+    stats.scans++;
+
+    bool from_edge = edge_pending;
+    if (!from_edge && timer_elapsed32(last_read) < EDGE_MATRIX_RESCAN) {
+        return false;  // no edge since the last read: the pins can't have changed
+    }
+
+    if (from_edge) {
+        uint32_t latency = TIME_I2US(chVTTimeElapsedSinceX(edge_time));
+        stats.edges++;
+        stats.edge_latency_sum += latency;
+        if (latency > stats.edge_latency_max) {
+            stats.edge_latency_max = MIN(latency, UINT16_MAX);
+        }
+    }
+    edge_pending = false;
+    last_read    = timer_read32();
+    stats.reads++;
+
+    bool changed = false;
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        matrix_row_t value = 0;
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            pin_t pin = direct_pins[row][col];
+            if (pin != NO_PIN && gpio_read_pin(pin) == 0) {  // closed switch pulls the pin low
+                value |= MATRIX_ROW_SHIFTER << col;
+            }
+        }
+        if (current_matrix[row] != value) {
+            current_matrix[row] = value;
+            changed             = true;
+        }
+    }
+    return changed;
+}
+
+// Instrumentation counters
+const edge_matrix_stats_t *get_edge_matrix_stats(void) {
+    return &stats;
+}
+
+// Clear the instrumentation counters
+void edge_matrix_stats_reset(void) {
+    memset(&stats, 0, sizeof(stats));
+    stats.rescan_ms = EDGE_MATRIX_RESCAN;
+}
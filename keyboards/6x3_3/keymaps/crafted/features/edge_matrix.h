@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Edge Matrix - Interrupt-assisted scanning for direct-pin matrices (ChibiOS)
+ *
+ * With one GPIO per key, every key change is a pin edge. Each pin gets a
+ * both-edges PAL interrupt that only raises a flag and timestamps the edge; the
+ * scan reads the pins when that flag is set and otherwise returns "no change"
+ * without touching the GPIOs. A full read still happens every EDGE_MATRIX_RESCAN
+ * ms, so a missed interrupt costs at most that much latency.
+ *
+ * Debounce is unchanged and still runs every scan: only the pin reads are skipped.
+ *
+ * Instrumentation (read through Host Link, see tools/xc_telemetry.py --matrix):
+ * scans, pin reads, edges, and the latency from an edge interrupt to the scan that
+ * read it. Compare with telemetry's scan rate on a polling build.
+ *
+ * Usage:
+ * 1. CUSTOM_MATRIX = lite and edge_matrix.c in SRC (rules.mk)
+ * 2. PAL_USE_CALLBACKS TRUE (halconf.h)
+ * 3. The keyboard defines DIRECT_PINS (and DIRECT_PINS_RIGHT on splits)
+ */
+
+#ifndef EDGE_MATRIX_RESCAN
+#    define EDGE_MATRIX_RESCAN 50  // ms between full reads with no interrupt
+#endif
+
+// Fields are ordered so the struct has no padding: the host decodes it as laid out here
+typedef struct {
+    uint32_t scans;             // matrix_scan_custom() calls
+    uint32_t reads;             // of which read the pins
+    uint32_t edges;             // reads triggered by an interrupt
+    uint32_t edge_latency_sum;  // us, interrupt to read, over edges
+    uint16_t edge_latency_max;  // us
+    uint16_t rescan_ms;         // EDGE_MATRIX_RESCAN
+} edge_matrix_stats_t;
+
+// Instrumentation counters
+const edge_matrix_stats_t *get_edge_matrix_stats(void);
+
+// Clear the instrumentation counters
+void edge_matrix_stats_reset(void);
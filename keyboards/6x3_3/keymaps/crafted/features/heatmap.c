@@ -0,0 +1,94 @@
+#include QMK_KEYBOARD_H
+#include "heatmap.h"
+
+/*
+ * Heatmap - Per-position, per-layer key press counters
+ *
+ * EEPROM layout (user datablock, offset 0): a magic word, then one row of
+ * KEY_POSITION_COUNT counters per layer. A row is only rewritten when it changed.
+ */
+
+#define HEATMAP_MAGIC      0x484D4150  // "HMAP"; bump when the layout changes
+#define HEATMAP_ROW_SIZE   (KEY_POSITION_COUNT * sizeof(uint16_t))
+#define HEATMAP_ROW_OFFSET(layer) (sizeof(uint32_t) + (layer) * HEATMAP_ROW_SIZE)
+
+_Static_assert(HEATMAP_LAYERS <= 8, "dirty_layers is a uint8_t bitmask");
+#ifdef EECONFIG_USER_DATA_SIZE
+_Static_assert(HEATMAP_EEPROM_SIZE <= EECONFIG_USER_DATA_SIZE, "EECONFIG_USER_DATA_SIZE is too small for the heatmap");
+#endif
+
+static uint16_t heatmap[HEATMAP_LAYERS][KEY_POSITION_COUNT];
+static uint8_t  dirty_layers    = 0;  // bit per layer row changed since the last flush
+static uint32_t last_flush_time = 0;
+static uint32_t last_press_time = 0;
+static bool     loaded          = false;  // RAM counters hold the EEPROM ones
+
+// Write changed counters now - call from suspend_power_down_user()
+void heatmap_flush(void) {
+    if (!loaded || !dirty_layers) {
+        return;
+    }
+    for (uint8_t layer = 0; layer < HEATMAP_LAYERS; layer++) {
+        if (dirty_layers & (1 << layer)) {
+            eeconfig_update_user_datablock(heatmap[layer], HEATMAP_ROW_OFFSET(layer), HEATMAP_ROW_SIZE);
+        }
+    }
+    dirty_layers    = 0;
+    last_flush_time = timer_read32();
+}
+
+// Load counters from EEPROM - call from keyboard_post_init_user()
+void heatmap_init(void) {
+    uint32_t magic = 0;
+    eeconfig_read_user_datablock(&magic, 0, sizeof(magic));
+    loaded = true;
+    if (magic != HEATMAP_MAGIC) {
+        heatmap_reset();
+        return;
+    }
+    eeconfig_read_user_datablock(heatmap, HEATMAP_ROW_OFFSET(0), HEATMAP_COUNTS_SIZE);
+    last_flush_time = timer_read32();
+}
+
+// Count a press - call from process_record_user()
+bool process_heatmap(uint16_t keycode, keyrecord_t *record) {
+    if (!loaded || !record->event.pressed) {
+        return true;
+    }
+    uint8_t pos = get_key_position(record->event.key);
+    if (pos == KEY_POSITION_NONE) {
+        return true;  // combo events and other synthetic records
+    }
+    uint8_t layer = layer_switch_get_layer(record->event.key);
+    if (layer >= HEATMAP_LAYERS) {
+        return true;
+    }
+    if (heatmap[layer][pos] < UINT16_MAX) {
+        heatmap[layer][pos]++;
+        dirty_layers |= 1 << layer;
+    }
+    last_press_time = timer_read32();
+    return true;
+}
+
+// Flush pending counters when due - call from housekeeping_task_user()
+void heatmap_task(void) {
+    if (dirty_layers && timer_elapsed32(last_flush_time) >= HEATMAP_FLUSH_INTERVAL && timer_elapsed32(last_press_time) >= HEATMAP_FLUSH_IDLE) {
+        heatmap_flush();
+    }
+}
+
+// Counters as [layer][position]
+const uint16_t *get_heatmap(void) {
+    return &heatmap[0][0];
+}
+
+// Clear all counters, in RAM and EEPROM
+void heatmap_reset(void) {
+    uint32_t magic = HEATMAP_MAGIC;
+    memset(heatmap, 0, sizeof(heatmap));
+    loaded = true;
+    eeconfig_update_user_datablock(&magic, 0, sizeof(magic));
+    dirty_layers = (1 << HEATMAP_LAYERS) - 1;
+    heatmap_flush();
+}
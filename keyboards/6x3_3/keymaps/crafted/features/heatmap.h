@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+#include "key_positions.h"
+
+/*
+ * Heatmap - Per-position, per-layer key press counters
+ *
+ * Counts presses of every abstract position (0-41) on the layer the key resolved
+ * from, in saturating 16-bit counters. Counters live in RAM and are persisted to
+ * the user EEPROM datablock on a wear-aware schedule: only layers that changed are
+ * written, at most once per HEATMAP_FLUSH_INTERVAL, and only once the keyboard has
+ * been idle for HEATMAP_FLUSH_IDLE so a flash write never lands mid-burst.
+ *
+ * The host reads the counters through Host Link and turns them into a keymap_drawer
+ * overlay (see tools/xc_heatmap.py).
+ *
+ * Usage in keymap.c:
+ * 1. heatmap.c and key_positions.c in SRC (rules.mk), and
+ *    EECONFIG_USER_DATA_SIZE >= HEATMAP_EEPROM_SIZE (config.h)
+ * 2. Call heatmap_init() from keyboard_post_init_user() or later (presses before it are
+ *    not counted)
+ * 3. Call process_heatmap() in process_record_user()
+ * 4. Call heatmap_task() from housekeeping_task_user(), and heatmap_flush() from
+ *    suspend_power_down_user() so a sleeping host doesn't lose the last interval
+ */
+
+#ifndef HEATMAP_LAYERS
+#    define HEATMAP_LAYERS 6  // layers 0 to HEATMAP_LAYERS - 1 are counted
+#endif
+
+#ifndef HEATMAP_FLUSH_INTERVAL
+#    define HEATMAP_FLUSH_INTERVAL 600000  // ms, at most one EEPROM write per 10 minutes
+#endif
+
+#ifndef HEATMAP_FLUSH_IDLE
+#    define HEATMAP_FLUSH_IDLE 5000  // ms without a keypress before flushing
+#endif
+
+#define HEATMAP_COUNTS_SIZE (HEATMAP_LAYERS * KEY_POSITION_COUNT * sizeof(uint16_t))
+#define HEATMAP_EEPROM_SIZE (sizeof(uint32_t) + HEATMAP_COUNTS_SIZE)  // magic + counters
+
+// Load counters from EEPROM - call once at startup; nothing is counted or written before
+void heatmap_init(void);
+
+// Count a press - call from process_record_user()
+// Always returns true: it only observes
+bool process_heatmap(uint16_t keycode, keyrecord_t *record);
+
+// Flush pending counters when due - call from housekeeping_task_user()
+void heatmap_task(void);
+
+// Write changed counters now - call from suspend_power_down_user()
+void heatmap_flush(void);
+
+// Counters as [layer][position], HEATMAP_COUNTS_SIZE bytes, little-endian
+const uint16_t *get_heatmap(void);
+
+// Clear all counters, in RAM and EEPROM
+void heatmap_reset(void);
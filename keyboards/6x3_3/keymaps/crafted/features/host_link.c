@@ -0,0 +1,252 @@
+#include QMK_KEYBOARD_H
+#include "raw_hid.h"
+#include "../custom_keycodes.h"
+#include "host_link.h"
+#include "os_control.h"
+#include "semantic_keys.h"
+#include "boot_profile.h"
+#ifdef XC_TELEMETRY
+#    include "telemetry.h"
+#endif
+#ifdef XC_HEATMAP
+#    include "heatmap.h"
+#endif
+#ifdef XC_EAGER_DEBOUNCE
+#    include "eager_debounce.h"
+#endif
+#ifdef XC_TUNABLES
+#    include "tunables.h"
+_Static_assert(1 + sizeof(tunables_t) <= HOST_LINK_PACKET_SIZE - 2, "tunables must fit one reply");
+#endif
+#ifdef XC_EDGE_MATRIX
+#    include "edge_matrix.h"
+_Static_assert(sizeof(edge_matrix_stats_t) <= HOST_LINK_PACKET_SIZE - 2, "matrix stats must fit one reply");
+#endif
+
+_Static_assert(BOOT_PHASE_COUNT * sizeof(uint32_t) <= HOST_LINK_PACKET_SIZE - 2, "boot profile must fit one reply");
+
+/*
+ * Host Link - Raw HID command channel
+ *
+ * Each handler validates its arguments, applies them, and fills the reply payload;
+ * set commands fall through to their getter so both answer identically.
+ */
+
+#define HL_RUNTIME_FEATURES (HL_FEATURE_COMBOS | HL_FEATURE_KEY_OVERRIDES)
+
+// Paged blocks: [0] = page count, [1] = bytes in this page, then the slice
+#define HL_PAGE_SIZE (HOST_LINK_PACKET_SIZE - 4)
+
+// Copy a name into the payload after the value byte (always NUL-terminated)
+static void reply_name(host_link_reply_t *reply, const char *name) {
+    strncpy((char *)&reply->payload[1], name, sizeof(reply->payload) - 2);
+}
+
+#if defined(XC_TELEMETRY) || defined(XC_HEATMAP) || defined(XC_EAGER_DEBOUNCE)
+// Copy one page of a RAM block into the payload
+static uint8_t reply_page(host_link_reply_t *reply, const void *block, uint16_t size, uint8_t page) {
+    uint8_t pages = (size + HL_PAGE_SIZE - 1) / HL_PAGE_SIZE;
+    if (page >= pages) {
+        return HL_ERR_INVALID_VALUE;
+    }
+    uint16_t offset   = page * HL_PAGE_SIZE;
+    reply->payload[0] = pages;
+    reply->payload[1] = MIN(HL_PAGE_SIZE, size - offset);
+    memcpy(&reply->payload[2], (const uint8_t *)block + offset, reply->payload[1]);
+    return HL_OK;
+}
+#endif
+
+#ifdef XC_TUNABLES
+// Tunable count, then the values in id order
+static uint8_t reply_tunables(host_link_reply_t *reply) {
+    reply->payload[0] = TUNABLE_COUNT;
+    memcpy(&reply->payload[1], &tunables, sizeof(tunables_t));
+    return HL_OK;
+}
+#endif
+
+static uint8_t get_runtime_features(void) {
+    uint8_t flags = 0;
+    if (is_combo_enabled()) flags |= HL_FEATURE_COMBOS;
+    if (is_key_override_enabled()) flags |= HL_FEATURE_KEY_OVERRIDES;
+    return flags;
+}
+
+static void set_runtime_features(uint8_t mask, uint8_t values) {
+    if (mask & HL_FEATURE_COMBOS) {
+        (values & HL_FEATURE_COMBOS) ? combo_enable() : combo_disable();
+    }
+    if (mask & HL_FEATURE_KEY_OVERRIDES) {
+        (values & HL_FEATURE_KEY_OVERRIDES) ? key_override_on() : key_override_off();
+    }
+}
+
+static uint8_t get_build_flags(void) {
+    uint8_t flags = 0;
+#ifdef XC_WEAK_CORNERS
+    flags |= HL_BUILD_WEAK_CORNERS;
+#endif
+#ifdef XC_ALT_BASE_SYMBOLS
+    flags |= HL_BUILD_ALT_BASE_SYMBOLS;
+#endif
+#ifdef XC_WORD_CHORDS
+    flags |= HL_BUILD_WORD_CHORDS;
+#endif
+#ifdef XC_TELEMETRY
+    flags |= HL_BUILD_TELEMETRY;
+#endif
+#ifdef XC_HEATMAP
+    flags |= HL_BUILD_HEATMAP;
+#endif
+#ifdef XC_EAGER_DEBOUNCE
+    flags |= HL_BUILD_EAGER_DEBOUNCE;
+#endif
+#ifdef XC_EDGE_MATRIX
+    flags |= HL_BUILD_EDGE_MATRIX;
+#endif
+#ifdef XC_TUNABLES
+    flags |= HL_BUILD_TUNABLES;
+#endif
+    return flags;
+}
+
+// Run one command: returns the status, fills the reply payload
+static uint8_t host_link_dispatch(const uint8_t *args, host_link_reply_t *reply) {
+    switch (reply->command) {
+        case HL_CMD_GET_VERSION:
+            reply->payload[0] = HOST_LINK_PROTOCOL_VERSION;
+            return HL_OK;
+
+        case HL_CMD_SET_CONTEXT:
+            if (args[0] >= _SK_CTX_COUNT) {
+                return HL_ERR_INVALID_VALUE;
+            }
+            set_semkey_context(args[0]);
+            // fall through
+        case HL_CMD_GET_CONTEXT:
+            reply->payload[0] = get_semkey_context();
+            return HL_OK;
+
+        case HL_CMD_SET_OS:
+            if (args[0] >= _OS_COUNT) {
+                return HL_ERR_INVALID_VALUE;
+            }
+            set_os_platform(args[0]);
+            // fall through
+        case HL_CMD_GET_OS:
+            reply->payload[0] = get_os_platform();
+            reply_name(reply, get_os_platform_name());
+            return HL_OK;
+
+        case HL_CMD_SET_LAYOUT:
+            if (args[0] > 1) {
+                return HL_ERR_INVALID_VALUE;
+            }
+            host_link_set_layout(args[0]);
+            // fall through
+        case HL_CMD_GET_LAYOUT:
+            reply->payload[0] = host_link_get_layout();
+            reply_name(reply, host_link_layout_name(reply->payload[0]));
+            return HL_OK;
+
+        case HL_CMD_SET_COMPOSE:
+            if (args[0] > 1) {
+                return HL_ERR_INVALID_VALUE;
+            }
+            host_link_set_compose(args[0]);
+            // fall through
+        case HL_CMD_GET_COMPOSE:
+            reply->payload[0] = host_link_get_compose();
+            return HL_OK;
+
+        case HL_CMD_SET_FEATURES:
+            if (args[0] & ~HL_RUNTIME_FEATURES) {
+                return HL_ERR_INVALID_VALUE;  // build flags can't be changed at runtime
+            }
+            set_runtime_features(args[0], args[1]);
+            // fall through
+        case HL_CMD_GET_FEATURES:
+            reply->payload[0] = get_runtime_features();
+            reply->payload[1] = get_build_flags();
+            return HL_OK;
+
+#ifdef XC_TELEMETRY
+        case HL_CMD_GET_TELEMETRY:
+            return reply_page(reply, get_telemetry(), sizeof(telemetry_t), args[0]);
+
+        case HL_CMD_RESET_TELEMETRY:
+            telemetry_reset();
+            return HL_OK;
+#endif
+
+#ifdef XC_HEATMAP
+        case HL_CMD_GET_HEATMAP:
+            return reply_page(reply, get_heatmap(), HEATMAP_COUNTS_SIZE, args[0]);
+
+        case HL_CMD_RESET_HEATMAP:
+            heatmap_reset();
+            return HL_OK;
+#endif
+
+#ifdef XC_EAGER_DEBOUNCE
+        case HL_CMD_GET_DEBOUNCE:
+            return reply_page(reply, get_debounce_stats(), sizeof(debounce_stats_t), args[0]);
+
+        case HL_CMD_RESET_DEBOUNCE:
+            debounce_stats_reset();
+            return HL_OK;
+#endif
+
+#ifdef XC_EDGE_MATRIX
+        case HL_CMD_GET_MATRIX:
+            memcpy(reply->payload, get_edge_matrix_stats(), sizeof(edge_matrix_stats_t));
+            return HL_OK;
+
+        case HL_CMD_RESET_MATRIX:
+            edge_matrix_stats_reset();
+            return HL_OK;
+#endif
+
+#ifdef XC_TUNABLES
+        case HL_CMD_SET_TUNABLE:
+            if (!tunables_set(args[0], args[1] | args[2] << 8)) {
+                return HL_ERR_INVALID_VALUE;
+            }
+            // fall through
+        case HL_CMD_GET_TUNABLES:
+            return reply_tunables(reply);
+
+        case HL_CMD_SAVE_TUNABLES:
+            tunables_save();
+            return reply_tunables(reply);
+
+        case HL_CMD_RESET_TUNABLES:
+            tunables_reset();
+            return reply_tunables(reply);
+#endif
+
+        case HL_CMD_GET_BOOT:
+            memcpy(reply->payload, get_boot_profile(), BOOT_PHASE_COUNT * sizeof(uint32_t));
+            return HL_OK;
+
+        default:
+            return HL_ERR_UNKNOWN_COMMAND;
+    }
+}
+
+void raw_hid_receive(uint8_t *data, uint8_t length) {
+    if (length != HOST_LINK_PACKET_SIZE) {
+        return;
+    }
+
+    // The reply reuses the request buffer: keep the arguments aside first
+    uint8_t args[HOST_LINK_PACKET_SIZE - 1];
+    memcpy(args, &data[1], sizeof(args));
+
+    host_link_reply_t *reply = (host_link_reply_t *)data;
+    memset(reply->payload, 0, sizeof(reply->payload));
+    reply->status = host_link_dispatch(args, reply);
+
+    raw_hid_send(data, length);
+}
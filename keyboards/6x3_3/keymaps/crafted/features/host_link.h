@@ -0,0 +1,100 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Host Link - Raw HID command channel
+ *
+ * Lets host-side tools (see tools/ at the repository root) read and drive keyboard
+ * state that is otherwise only reachable from the ADJUST layer: OS platform, default
+ * layout, compose, runtime feature toggles, and the app context used by semantic keys.
+ * With XC_TELEMETRY, XC_HEATMAP, XC_EAGER_DEBOUNCE and XC_EDGE_MATRIX, it also reads
+ * out the typing statistics, the per-key press counters and the debounce and matrix
+ * scan instrumentation. With XC_TUNABLES, it reads, edits and saves the timing
+ * parameters and feature toggles. The boot-phase timeline is always available.
+ *
+ * Packets are HOST_LINK_PACKET_SIZE (32) bytes; byte 0 is the command, the rest its
+ * arguments.
+ * Every command is answered with a host_link_reply_t: the command byte, a status
+ * byte, then the command's payload. Set commands answer with the same payload as
+ * their get counterpart, so the host always sees the resulting state.
+ *
+ * Hosts should check HL_CMD_GET_VERSION first: HOST_LINK_PROTOCOL_VERSION is bumped
+ * whenever an existing command changes meaning; new commands don't bump it (older
+ * firmware answers them with HL_ERR_UNKNOWN_COMMAND).
+ *
+ * Usage:
+ * 1. RAW_ENABLE = yes and host_link.c in SRC (rules.mk)
+ * 2. Implement the host_link_*_layout() and host_link_*_compose() hooks in keymap.c
+ * 3. Nothing to call: QMK invokes raw_hid_receive() on every packet
+ */
+
+#define HOST_LINK_PROTOCOL_VERSION 1
+#define HOST_LINK_PACKET_SIZE      32  // RAW_EPSIZE
+
+// Command identifiers (byte 0 of a packet); payloads are those of the reply
+enum host_link_command {
+    HL_CMD_GET_VERSION     = 0x00,  //                         -> [2] = protocol version
+    HL_CMD_SET_CONTEXT     = 0x01,  // [1] = semkey_context_t  -> [2] = context
+    HL_CMD_GET_CONTEXT     = 0x02,  //                         -> [2] = context
+    HL_CMD_GET_OS          = 0x03,  //                         -> [2] = os_platform_t, [3..] = name
+    HL_CMD_SET_OS          = 0x04,  // [1] = os_platform_t     -> same as GET_OS
+    HL_CMD_GET_LAYOUT      = 0x05,  //                         -> [2] = 0 primary / 1 secondary, [3..] = name
+    HL_CMD_SET_LAYOUT      = 0x06,  // [1] = 0 / 1             -> same as GET_LAYOUT
+    HL_CMD_GET_COMPOSE     = 0x07,  //                         -> [2] = 1 if armed
+    HL_CMD_SET_COMPOSE     = 0x08,  // [1] = 0 / 1             -> same as GET_COMPOSE
+    HL_CMD_GET_FEATURES    = 0x09,  //                         -> [2] = runtime flags, [3] = build flags
+    HL_CMD_SET_FEATURES    = 0x0A,  // [1] = mask, [2] = values (runtime flags only) -> same as GET_FEATURES
+    HL_CMD_GET_TELEMETRY   = 0x0B,  // [1] = page              -> [2] = page count, [3] = bytes, [4..] = telemetry_t slice
+    HL_CMD_RESET_TELEMETRY = 0x0C,  //                         -> nothing
+    HL_CMD_GET_HEATMAP     = 0x0D,  // [1] = page              -> [2] = page count, [3] = bytes, [4..] = counters slice
+    HL_CMD_RESET_HEATMAP   = 0x0E,  //                         -> nothing
+    HL_CMD_GET_DEBOUNCE    = 0x0F,  // [1] = page              -> [2] = page count, [3] = bytes, [4..] = debounce_stats_t slice
+    HL_CMD_RESET_DEBOUNCE  = 0x10,  //                         -> nothing
+    HL_CMD_GET_MATRIX      = 0x11,  //                         -> [2..] = edge_matrix_stats_t
+    HL_CMD_RESET_MATRIX    = 0x12,  //                         -> nothing
+    HL_CMD_GET_BOOT        = 0x13,  //                         -> [2..] = boot phase times, uint32 ms each
+    HL_CMD_GET_TUNABLES    = 0x14,  //                         -> [2] = count, [3..] = tunables_t
+    HL_CMD_SET_TUNABLE     = 0x15,  // [1] = id, [2..3] = value (LE) -> same as GET_TUNABLES
+    HL_CMD_SAVE_TUNABLES   = 0x16,  //                         -> same as GET_TUNABLES
+    HL_CMD_RESET_TUNABLES  = 0x17,  //                         -> same as GET_TUNABLES (build defaults, not saved)
+};
+
+// Status codes (byte 1 of a reply)
+enum host_link_status {
+    HL_OK = 0x00,
+    HL_ERR_UNKNOWN_COMMAND,
+    HL_ERR_INVALID_VALUE,
+};
+
+// Runtime feature flags (GET/SET_FEATURES)
+enum host_link_feature {
+    HL_FEATURE_COMBOS        = 1 << 0,
+    HL_FEATURE_KEY_OVERRIDES = 1 << 1,
+};
+
+// Build flags (GET_FEATURES, read-only): XC_* options compiled in
+enum host_link_build_flag {
+    HL_BUILD_WEAK_CORNERS     = 1 << 0,
+    HL_BUILD_ALT_BASE_SYMBOLS = 1 << 1,
+    HL_BUILD_WORD_CHORDS      = 1 << 2,
+    HL_BUILD_TELEMETRY        = 1 << 3,
+    HL_BUILD_HEATMAP          = 1 << 4,
+    HL_BUILD_EAGER_DEBOUNCE   = 1 << 5,
+    HL_BUILD_EDGE_MATRIX      = 1 << 6,
+    HL_BUILD_TUNABLES         = 1 << 7,
+};
+
+typedef struct {
+    uint8_t command;
+    uint8_t status;
+    uint8_t payload[HOST_LINK_PACKET_SIZE - 2];
+} host_link_reply_t;
+
+// To be implemented by the consumer: keymap state the host can reach
+uint8_t     host_link_get_layout(void);            // 0 = primary, 1 = secondary
+void        host_link_set_layout(uint8_t layout);  // only called with 0 or 1
+const char *host_link_layout_name(uint8_t layout);
+bool        host_link_get_compose(void);
+void        host_link_set_compose(bool armed);
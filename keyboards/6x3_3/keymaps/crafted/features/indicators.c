@@ -0,0 +1,113 @@
+#include QMK_KEYBOARD_H
+#include "indicators.h"
+
+/*
+ * Indicators - Event-driven RGB layer and mode indicators
+ *
+ * Only the bits shown on the LEDs are compared, so changes elsewhere in the user
+ * state (e.g. the app context) don't cost a redraw.
+ */
+
+#ifdef RGBLIGHT_ENABLE
+
+typedef struct {
+    uint8_t r, g, b;
+} indicator_colour_t;
+
+static const indicator_colour_t colour_off       = {0x00, 0x00, 0x00};
+static const indicator_colour_t colour_os_mac    = {0x30, 0x30, 0x30};  // white
+static const indicator_colour_t colour_os_linux  = {0x30, 0x18, 0x00};  // amber
+static const indicator_colour_t colour_caps_word = {0x40, 0x00, 0x00};  // red
+static const indicator_colour_t colour_compose   = {0x30, 0x00, 0x30};  // magenta
+static const indicator_colour_t colour_sel_latch = {0x00, 0x30, 0x30};  // cyan
+static const indicator_colour_t colour_lock      = {0x30, 0x30, 0x00};  // yellow
+
+// Layer colours from INDICATOR_FIRST_LAYER upwards
+static const indicator_colour_t layer_colours[] = {
+    {0x00, 0x00, 0x40},  // blue
+    {0x00, 0x40, 0x00},  // green
+    {0x40, 0x10, 0x00},  // orange
+    {0x20, 0x00, 0x40},  // violet
+    {0x40, 0x00, 0x20},  // pink
+    {0x00, 0x20, 0x40},  // sky
+};
+
+static user_state_t drawn;                        // state currently on the LEDs
+static rgb_led_t    picture[RGBLIGHT_LED_COUNT];  // led[] as last drawn
+static bool         drawn_valid = false;
+static bool         ready       = false;  // indicators_init() has run
+
+// Everything but the swapper and the app context
+static bool same_picture(user_state_t a, user_state_t b) {
+    return a.layer == b.layer && a.os_mac == b.os_mac && a.compose == b.compose && a.sel_latch == b.sel_latch &&
+           a.caps_word == b.caps_word && a.layer_lock == b.layer_lock;
+}
+
+static void set_led(uint8_t index, indicator_colour_t colour) {
+    if (index < RGBLIGHT_LED_COUNT) {
+        led[index].r = colour.r;
+        led[index].g = colour.g;
+        led[index].b = colour.b;
+    }
+}
+
+static void indicators_draw(user_state_t state) {
+    indicator_colour_t layer = colour_off;
+    if (state.layer >= INDICATOR_FIRST_LAYER && state.layer - INDICATOR_FIRST_LAYER < ARRAY_SIZE(layer_colours)) {
+        layer = layer_colours[state.layer - INDICATOR_FIRST_LAYER];
+    }
+
+    for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+        set_led(i, layer);
+    }
+    set_led(INDICATOR_LED_OS, state.os_mac ? colour_os_mac : colour_os_linux);
+    set_led(INDICATOR_LED_CAPS_WORD, state.caps_word ? colour_caps_word : layer);
+    set_led(INDICATOR_LED_COMPOSE, state.compose ? colour_compose : layer);
+    set_led(INDICATOR_LED_SEL_LATCH, state.sel_latch ? colour_sel_latch : layer);
+    set_led(INDICATOR_LED_LAYER_LOCK, state.layer_lock ? colour_lock : layer);
+
+    rgblight_set();  // one flush per change, each half outputs its own range
+    memcpy(picture, led, sizeof(picture));
+    drawn       = state;
+    drawn_valid = true;
+}
+
+// Switch rgblight to a static mode, unless the user has turned it off
+void indicators_init(void) {
+    if (rgblight_is_enabled()) {
+        rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_LIGHT);
+    }
+    ready       = true;
+    drawn_valid = false;
+}
+
+void indicators_invalidate(void) {
+    drawn_valid = false;
+}
+
+// Redraw if the state changed, or if rgblight repainted the LEDs by itself (wakeup,
+// re-enable, or a sync from the master on the slave half)
+void indicators_update(user_state_t state) {
+    if (!ready) {
+        return;
+    }
+    if (!rgblight_is_enabled()) {
+        drawn_valid = false;  // draw again once turned back on
+        return;
+    }
+    if (rgblight_get_mode() != RGBLIGHT_MODE_STATIC_LIGHT) {
+        rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_LIGHT);  // turned back on: the saved mode restarted
+        drawn_valid = false;
+    }
+    if (!drawn_valid || !same_picture(drawn, state) || memcmp(picture, led, sizeof(picture)) != 0) {
+        indicators_draw(state);
+    }
+}
+
+#else
+
+void indicators_init(void) {}
+void indicators_invalidate(void) {}
+void indicators_update(user_state_t state) {}
+
+#endif
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+#include "split_sync.h"
+
+/*
+ * Indicators - Event-driven RGB layer and mode indicators
+ *
+ * Replaces the rgblight animation with a static picture of the keyboard's modal
+ * state: active layer, OS platform, compose, select latch, Caps Word and layer lock.
+ * The LEDs are only written when that state changes, so idle scans do no RGB work.
+ *
+ * The state comes from Split Sync, so both halves see the same user_state_t: each
+ * draws the full picture and rgblight outputs its own side.
+ *
+ * Default picture (12 LEDs, 6 per half):
+ * - left half: OS, Caps Word, compose, select latch, layer lock, layer
+ * - right half: layer colour (off on the base layers)
+ *
+ * Usage in keymap.c:
+ * 1. indicators.c and split_sync.c in SRC (rules.mk)
+ * 2. Call indicators_init() from keyboard_post_init_user() or later; nothing is drawn
+ *    before it
+ * 3. Call indicators_update(get_user_state()) from housekeeping_task_user(), on both halves
+ * 4. Call indicators_invalidate() from suspend_wakeup_init_user()
+ *
+ * Turning RGB off (RGB_TOG) is respected: nothing is drawn until it is back on.
+ *
+ * No-op without RGBLIGHT_ENABLE.
+ */
+
+// LED assignments (indices in the full rgblight chain)
+#ifndef INDICATOR_LED_OS
+#    define INDICATOR_LED_OS 0
+#endif
+#ifndef INDICATOR_LED_CAPS_WORD
+#    define INDICATOR_LED_CAPS_WORD 1
+#endif
+#ifndef INDICATOR_LED_COMPOSE
+#    define INDICATOR_LED_COMPOSE 2
+#endif
+#ifndef INDICATOR_LED_SEL_LATCH
+#    define INDICATOR_LED_SEL_LATCH 3
+#endif
+#ifndef INDICATOR_LED_LAYER_LOCK
+#    define INDICATOR_LED_LAYER_LOCK 4
+#endif
+
+// Layers below this are base layers: no layer colour
+#ifndef INDICATOR_FIRST_LAYER
+#    define INDICATOR_FIRST_LAYER 2
+#endif
+
+// Switch rgblight to a static mode - call once at startup
+void indicators_init(void);
+
+// Force a redraw on the next update, after rgblight has repainted the LEDs
+void indicators_invalidate(void);
+
+// Redraw if the state changed - call from housekeeping_task_user()
+void indicators_update(user_state_t state);
@@ -0,0 +1,26 @@
+#include QMK_KEYBOARD_H
+#include "key_positions.h"
+
+/*
+ * Key Positions - Matrix to abstract position lookup
+ *
+ * Entries are stored as position + 1: matrix slots without a key are filled with
+ * KC_NO (0) by the LAYOUT macro, so 0 reads back as "no position".
+ */
+
+static const uint8_t key_position_map[MATRIX_ROWS][MATRIX_COLS] PROGMEM =
+    LAYOUT_split_3x6_3(
+         1,  2,  3,  4,  5,  6,   7,  8,  9, 10, 11, 12,
+        13, 14, 15, 16, 17, 18,  19, 20, 21, 22, 23, 24,
+        25, 26, 27, 28, 29, 30,  31, 32, 33, 34, 35, 36,
+                    37, 38, 39,  40, 41, 42
+    );
+
+// Abstract position (0-41) of a matrix location, KEY_POSITION_NONE if unused
+uint8_t get_key_position(keypos_t key) {
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return KEY_POSITION_NONE;
+    }
+    uint8_t entry = pgm_read_byte(&key_position_map[key.row][key.col]);
+    return entry ? entry - 1 : KEY_POSITION_NONE;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdint.h>
+#include "quantum.h"
+
+/*
+ * Key Positions - Matrix to abstract position lookup
+ *
+ * Maps a matrix location to the abstract _XX_ position used throughout the keymap
+ * (0-11 top row, 12-23 home row, 24-35 bottom row, 36-41 thumbs), independent of
+ * how each keyboard wires its matrix. Built from LAYOUT_split_3x6_3 like
+ * chordal_hold_layout, so it follows every supported keyboard automatically.
+ */
+
+#define KEY_POSITION_COUNT 42
+#define KEY_POSITION_NONE  0xFF
+
+// Abstract position (0-41) of a matrix location, KEY_POSITION_NONE if unused
+uint8_t get_key_position(keypos_t key);
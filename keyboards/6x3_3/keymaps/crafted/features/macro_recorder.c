@@ -0,0 +1,152 @@
+#include QMK_KEYBOARD_H
+#include "host.h"
+#include "../custom_keycodes.h"
+#include "macro_recorder.h"
+#include "output_queue.h"
+
+/*
+ * Macro Recorder - Two dynamic macro slots, replayed through the output queue
+ *
+ * Recording swaps in a copy of the host driver whose send_keyboard (and send_nkro)
+ * forward the report, then store the keys that were not in the previous one. Replay
+ * keeps a cursor into the slot and tops the output queue up on every task tick.
+ */
+
+static uint16_t macro_taps[MACRO_RECORDER_SLOTS][MACRO_RECORDER_SIZE];
+static uint16_t macro_length[MACRO_RECORDER_SLOTS];
+
+// Recording: the slot being written, the real driver and the previous report's keys
+static int8_t         recording_slot = -1;
+static host_driver_t *host_driver    = NULL;
+static host_driver_t  recorder_driver;
+static uint8_t        last_keys[KEYBOARD_REPORT_KEYS];
+#ifdef NKRO_ENABLE
+static uint8_t last_bits[NKRO_REPORT_BITS];
+#endif
+
+// Replay: slot, position, passes left including the current one
+static int8_t   play_slot   = -1;
+static uint16_t play_index  = 0;
+static uint8_t  play_passes = 0;
+
+bool is_macro_recording(void) {
+    return recording_slot >= 0;
+}
+
+// 8-bit report modifiers as the modifier bits of a 16-bit keycode, which holds one
+// side only: right-hand modifiers are kept when no left-hand one is down (AltGr)
+static uint16_t keycode_mods(uint8_t mods) {
+    uint8_t left  = mods & 0x0F;
+    uint8_t right = mods >> 4;
+    if (left || !right) {
+        return (uint16_t)left << 8;
+    }
+    return (uint16_t)(right | 0x10) << 8;
+}
+
+static void record_tap(uint8_t mods, uint8_t key) {
+    if (macro_length[recording_slot] < MACRO_RECORDER_SIZE) {
+        macro_taps[recording_slot][macro_length[recording_slot]++] = keycode_mods(mods) | key;
+    }
+}
+
+static void recorder_send_keyboard(report_keyboard_t *report) {
+    host_driver->send_keyboard(report);
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        uint8_t key = report->keys[i];
+        if (key != KC_NO && !memchr(last_keys, key, sizeof(last_keys))) {
+            record_tap(report->mods, key);
+        }
+    }
+    memcpy(last_keys, report->keys, sizeof(last_keys));
+}
+
+#ifdef NKRO_ENABLE
+static void recorder_send_nkro(report_nkro_t *report) {
+    host_driver->send_nkro(report);
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        uint8_t pressed = report->bits[i] & ~last_bits[i];
+        for (uint8_t bit = 0; pressed; bit++, pressed >>= 1) {
+            if (pressed & 1) {
+                record_tap(report->mods, i * 8 + bit);
+            }
+        }
+    }
+    memcpy(last_bits, report->bits, sizeof(last_bits));
+}
+#endif
+
+static void start_recording(uint8_t slot) {
+    play_slot = -1;  // a replay in progress would be recorded
+    output_queue_clear();
+
+    recording_slot     = slot;
+    macro_length[slot] = 0;
+    memset(last_keys, 0, sizeof(last_keys));
+#ifdef NKRO_ENABLE
+    memset(last_bits, 0, sizeof(last_bits));
+#endif
+
+    host_driver                   = host_get_driver();
+    recorder_driver               = *host_driver;
+    recorder_driver.send_keyboard = recorder_send_keyboard;
+#ifdef NKRO_ENABLE
+    recorder_driver.send_nkro = recorder_send_nkro;
+#endif
+    host_set_driver(&recorder_driver);
+}
+
+static void stop_recording(void) {
+    host_set_driver(host_driver);
+    host_driver    = NULL;
+    recording_slot = -1;
+}
+
+void macro_recorder_play(uint8_t slot, uint8_t count) {
+    if (is_macro_recording() || slot >= MACRO_RECORDER_SLOTS || macro_length[slot] == 0 || count == 0) {
+        return;
+    }
+    play_slot   = slot;
+    play_index  = 0;
+    play_passes = count;
+}
+
+// Process MR_REC / MR_PLY - call from process_record_user()
+bool process_macro_recorder(uint16_t keycode, keyrecord_t *record) {
+    if (keycode != MR_REC && keycode != MR_PLY) {
+        return true;
+    }
+    if (record->event.pressed) {
+        uint8_t slot = ((get_mods() | get_oneshot_mods()) & MOD_MASK_SHIFT) ? 1 : 0;
+        if (is_macro_recording()) {
+            stop_recording();  // either key ends a recording
+        } else if (keycode == MR_REC) {
+            start_recording(slot);
+        } else {
+            macro_recorder_play(slot, 1);
+        }
+    }
+    return false;
+}
+
+// Feed the output queue while a replay runs - call from housekeeping_task_user()
+void macro_recorder_task(void) {
+    if (is_macro_recording() && macro_length[recording_slot] == MACRO_RECORDER_SIZE) {
+        stop_recording();  // full
+    }
+
+    // Held modifiers (e.g. the Shift that picked slot 2) would apply to every tap
+    if (play_slot < 0 || get_mods()) {
+        return;
+    }
+    while (output_queue_push(macro_taps[play_slot][play_index], 1)) {
+        if (++play_index < macro_length[play_slot]) {
+            continue;
+        }
+        play_index = 0;
+        if (--play_passes == 0) {
+            play_slot = -1;
+            break;
+        }
+    }
+}
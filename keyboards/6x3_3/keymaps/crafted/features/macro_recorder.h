@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Macro Recorder - Two dynamic macro slots, replayed through the output queue
+ *
+ * MR_REC starts recording (Shift+MR_REC: slot 2) and stops it; MR_PLY replays slot 1
+ * (Shift+MR_PLY: slot 2). A count prefix before MR_PLY replays the macro that many
+ * times. Replay waits until the modifiers are released, then runs without blocking:
+ * the output queue emits one tap per housekeeping tick, as fast as the host takes
+ * the reports.
+ *
+ * What is recorded is the output, not the keys: while recording, the keyboard
+ * reports sent to the host are watched, and every key that appears in a report is
+ * stored with the modifiers of that report, as one 16-bit modded keycode. Semantic
+ * keys are stored as the OS sequence they sent, and so are dead keys, compose,
+ * counted motions and hold-to-shift symbols. Modifier-only taps, mouse keys and host
+ * key repeat are not recorded.
+ *
+ * The host driver is only wrapped while recording: outside of it, reports go
+ * straight to the host.
+ *
+ * Usage in keymap.c:
+ * 1. XC_MACRO_RECORDER = yes in rules.mk (with output_queue.c)
+ * 2. Call process_macro_recorder() in process_record_user(), after process_count_prefix()
+ * 3. Call macro_recorder_task() from housekeeping_task_user(), before output_queue_task()
+ * 4. Route MR_PLY to macro_recorder_play() from count_prefix_user() for counted replays
+ */
+
+#ifndef MACRO_RECORDER_SIZE
+#    define MACRO_RECORDER_SIZE 128  // taps per slot (2 bytes each)
+#endif
+#define MACRO_RECORDER_SLOTS 2
+
+// Process MR_REC / MR_PLY - call from process_record_user()
+// Returns true to continue processing, false if handled
+bool process_macro_recorder(uint16_t keycode, keyrecord_t *record);
+
+// Feed the output queue while a replay runs - call from housekeeping_task_user()
+void macro_recorder_task(void);
+
+// Replay a slot `count` times (ignored while recording or when the slot is empty)
+void macro_recorder_play(uint8_t slot, uint8_t count);
+
+// True while recording
+bool is_macro_recording(void);
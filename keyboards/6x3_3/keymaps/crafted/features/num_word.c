@@ -0,0 +1,137 @@
+#include QMK_KEYBOARD_H
+#include "../custom_keycodes.h"
+#include "num_word.h"
+
+/*
+ * Num Word - Auto-exiting numeric mode, modeled on Caps Word
+ *
+ * The numbers layer is switched on with layer_on() rather than a lock, so the
+ * thumbs stay free; the idle timer is refreshed by every accepted key.
+ *
+ * A terminator is replayed as a tap of its base-layer keycode through process_record(),
+ * like Repeat Key does, so Caps Word, key overrides and process_record_user() see it.
+ * A mod-tap there types its tap keycode. The terminator's own release is swallowed.
+ */
+
+static bool     num_word_active = false;
+static uint8_t  num_word_layer  = 0;
+static uint16_t num_word_timer  = 0;
+static bool     replaying       = false;
+static bool     ended_key_held  = false;  // the terminator is still down
+static keypos_t ended_key;
+
+bool is_num_word_on(void) {
+    return num_word_active;
+}
+
+bool is_num_word_replaying(void) {
+    return replaying;
+}
+
+static void num_word_on(uint8_t layer) {
+    num_word_active = true;
+    num_word_layer  = layer;
+    num_word_timer  = timer_read();
+    layer_on(layer);
+}
+
+void num_word_off(void) {
+    if (num_word_active) {
+        num_word_active = false;
+        layer_off(num_word_layer);
+    }
+}
+
+// The keycode this position produces on the base layer (tap keycode for mod-taps)
+static uint16_t base_layer_keycode(keyrecord_t *record) {
+    uint16_t kc = keymap_key_to_keycode(get_highest_layer(default_layer_state), record->event.key);
+    if (IS_QK_MOD_TAP(kc)) {
+        kc = QK_MOD_TAP_GET_TAP_KEYCODE(kc);
+    }
+    return kc;
+}
+
+// Tap `keycode` through the whole key pipeline, at the position and time of `record`
+static void replay_tap(uint16_t keycode, keyrecord_t *record) {
+    keyrecord_t replay = {.event = record->event, .keycode = keycode};
+    replaying          = true;
+    process_record(&replay);
+    wait_ms(TAP_CODE_DELAY);
+    replay.event.pressed = false;
+    process_record(&replay);
+    replaying = false;
+}
+
+// Process Num Word - call from process_record_user()
+bool process_num_word(uint16_t keycode, keyrecord_t *record, uint8_t layer) {
+    if (ended_key_held && !record->event.pressed && KEYEQ(record->event.key, ended_key)) {
+        ended_key_held = false;
+        return false;  // its press was replayed as a tap
+    }
+
+    if (keycode == NW_TOGG) {
+        if (record->event.pressed) {
+            if (num_word_active) {
+                num_word_off();
+            } else {
+                num_word_on(layer);
+            }
+        }
+        return false;
+    }
+
+    if (!num_word_active) {
+        return true;
+    }
+    if (!record->event.pressed) {
+        // Releasing MO() of the numbers layer switches it off: Num Word ends with it
+        if (IS_QK_MOMENTARY(keycode) && QK_MOMENTARY_GET_LAYER(keycode) == num_word_layer) {
+            num_word_active = false;
+        }
+        return true;
+    }
+
+    uint16_t kc = keycode;
+    if (IS_QK_MOD_TAP(keycode)) {
+        if (record->tap.count == 0) {
+            return true;  // mod-tap held as modifier: keep the number going
+        }
+        kc = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    }
+
+    switch (kc) {
+        case KC_LCTL ... KC_RGUI:
+        case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+            return true;  // modifiers and layer keys neither continue nor end a number (until released)
+        default:
+            break;
+    }
+
+    if (num_word_press_user(kc)) {
+        num_word_timer = timer_read();
+        return true;
+    }
+
+    // Terminator: leave the numbers layer, then type what the key means on the base
+    // layer (it was resolved on the numbers layer, where it may be another symbol)
+    num_word_off();
+    if (record->keycode) {
+        return true;  // a combo: its keycode does not depend on the layer
+    }
+    uint16_t base_kc = base_layer_keycode(record);
+    if (base_kc != NW_TOGG) {
+        replay_tap(base_kc, record);  // NW_TOGG under it: ending Num Word was the point
+    }
+    ended_key      = record->event.key;
+    ended_key_held = true;
+    return false;
+}
+
+// Idle timeout - call from housekeeping_task_user()
+void num_word_task(void) {
+#if NUM_WORD_IDLE_TIMEOUT > 0
+    if (num_word_active && timer_elapsed(num_word_timer) > NUM_WORD_IDLE_TIMEOUT) {
+        num_word_off();
+    }
+#endif
+}
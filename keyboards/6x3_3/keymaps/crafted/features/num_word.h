@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Num Word - Auto-exiting numeric mode, modeled on Caps Word
+ *
+ * Tapping NW_TOGG turns on the numbers layer for a run of digits and separators.
+ * Num Word turns itself off on the first key that num_word_press_user() rejects,
+ * after NUM_WORD_IDLE_TIMEOUT ms without a keypress, or when the MO() key of the
+ * numbers layer is released (that release switches the layer off). The rejected key is
+ * typed as it reads on the base layer (tap keycode for a mod-tap), through the normal key
+ * processing, so typing simply continues. While that tap is replayed,
+ * is_num_word_replaying() is true: key observers skip it, the physical press was counted.
+ *
+ * Usage in keymap.c:
+ * 1. Add num_word.c to SRC in rules.mk
+ * 2. Call process_num_word() in process_record_user() (before other features)
+ * 3. Call num_word_task() from housekeeping_task_user()
+ * 4. Implement num_word_press_user()
+ */
+
+#ifndef NUM_WORD_IDLE_TIMEOUT
+#    define NUM_WORD_IDLE_TIMEOUT 5000  // ms; 0 disables the timeout
+#endif
+
+// Process Num Word - `layer` is the numbers layer to activate
+// Returns true to continue processing, false if handled
+bool process_num_word(uint16_t keycode, keyrecord_t *record, uint8_t layer);
+
+// Idle timeout - call from housekeeping_task_user()
+void num_word_task(void);
+
+bool is_num_word_on(void);
+void num_word_off(void);
+
+// True while a terminator's base-layer tap goes through process_record()
+bool is_num_word_replaying(void);
+
+// To be implemented by the consumer. Returns true for keys that continue a number
+// (digits, separators, Backspace); any other key ends Num Word.
+// Receives the tap keycode for mod-taps.
+bool num_word_press_user(uint16_t keycode);
@@ -0,0 +1,81 @@
+#include QMK_KEYBOARD_H
+#include "../custom_keycodes.h"
+#include "output_queue.h"
+#include "semantic_keys.h"
+
+/*
+ * Output Queue - Non-blocking batched output
+ *
+ * Each entry is a keycode plus a repeat count; output_queue_task() taps the
+ * head entry once per call and pops it when its count reaches zero.
+ */
+
+typedef struct {
+    uint16_t keycode;
+    uint8_t  count;
+} output_entry_t;
+
+static output_entry_t queue[OUTPUT_QUEUE_SIZE];
+static uint8_t        queue_head = 0;
+static uint8_t        queue_len  = 0;
+
+// Queue a keycode to be tapped `count` times (public function)
+bool output_queue_push(uint16_t keycode, uint8_t count) {
+    if (count == 0) {
+        return true;
+    }
+    if (queue_len >= OUTPUT_QUEUE_SIZE) {
+        return false;
+    }
+
+    // Merge with the tail entry when repeating the same keycode
+    if (queue_len > 0) {
+        output_entry_t *tail = &queue[(queue_head + queue_len - 1) % OUTPUT_QUEUE_SIZE];
+        if (tail->keycode == keycode && tail->count <= UINT8_MAX - count) {
+            tail->count += count;
+            return true;
+        }
+    }
+
+    output_entry_t *entry = &queue[(queue_head + queue_len) % OUTPUT_QUEUE_SIZE];
+    entry->keycode        = keycode;
+    entry->count          = count;
+    queue_len++;
+    return true;
+}
+
+bool output_queue_busy(void) {
+    return queue_len > 0;
+}
+
+void output_queue_clear(void) {
+    queue_head = 0;
+    queue_len  = 0;
+}
+
+void output_queue_flush(void) {
+    while (queue_len > 0) {
+        output_queue_task();
+    }
+}
+
+// Emit the next queued tap - call from housekeeping_task_user()
+void output_queue_task(void) {
+    if (queue_len == 0) {
+        return;
+    }
+
+    output_entry_t *entry = &queue[queue_head];
+
+    // Semantic keys resolve to the current OS sequence; anything else is a plain tap
+    if (is_semkey(entry->keycode)) {
+        tap_semkey_code(entry->keycode);
+    } else {
+        tap_code16(entry->keycode);
+    }
+
+    if (--entry->count == 0) {
+        queue_head = (queue_head + 1) % OUTPUT_QUEUE_SIZE;
+        queue_len--;
+    }
+}
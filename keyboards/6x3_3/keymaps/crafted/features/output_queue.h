@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Output Queue - Non-blocking batched output
+ *
+ * Features that need to emit many taps at once (count prefixes, macro replay)
+ * push them here instead of looping over tap_code16() inside process_record_user().
+ * The queue is drained from housekeeping_task_user(), one tap per task tick, so a
+ * long batch never stalls the matrix scan. A key pressed before the batch is out
+ * flushes the rest first (output_queue_flush()), so output keeps its order.
+ *
+ * Design goals:
+ * - Fixed-size ring buffer, no allocation
+ * - Run-length entries: one slot holds a keycode and its repeat count
+ * - Semantic keys are resolved at emission time (current OS)
+ *
+ * Usage in keymap.c:
+ * 1. Add output_queue.c to SRC in rules.mk
+ * 2. Call output_queue_task() from housekeeping_task_user()
+ * 3. Call output_queue_flush() first in process_record_user(), on key presses
+ */
+
+#ifndef OUTPUT_QUEUE_SIZE
+#    define OUTPUT_QUEUE_SIZE 8
+#endif
+
+// Queue a keycode (basic, modded, or semantic key) to be tapped `count` times
+// Returns false if the queue is full (nothing is queued)
+bool output_queue_push(uint16_t keycode, uint8_t count);
+
+// True while queued output is still being emitted
+bool output_queue_busy(void);
+
+// Drop everything still pending
+void output_queue_clear(void);
+
+// Emit everything still pending now - before a key that has to come after it
+void output_queue_flush(void);
+
+// Emit the next queued tap - call from housekeeping_task_user()
+void output_queue_task(void);
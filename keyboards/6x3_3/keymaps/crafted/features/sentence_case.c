@@ -0,0 +1,182 @@
+#include QMK_KEYBOARD_H
+#include <string.h>
+#include "../custom_keycodes.h"
+#include "case_mode.h"
+#include "sentence_case.h"
+
+/*
+ * Sentence Case - Capitalize the first letter of a sentence
+ *
+ * A four-state machine fed by key presses only: the state is the one check every
+ * key pays, plus a byte appended to the current word for letters and dots.
+ * Abbreviations are only looked up when a . is typed.
+ */
+
+typedef enum {
+    SC_IDLE = 0,  // mid-sentence
+    SC_ENDED,     // after a terminator
+    SC_PRIMED,    // after a terminator and Space: the next letter is capitalized
+    SC_CAPPED,    // right after a capitalized letter: Backspace undoes it
+} sc_state_t;
+
+static sc_state_t sc_state  = SC_IDLE;
+static uint16_t   sc_capped = KC_NO;  // letter sent shifted, while SC_CAPPED
+
+// Current word (lowercase letters and dots); a length past the buffer means "too
+// long to be an abbreviation"
+static char    sc_word[SENTENCE_CASE_WORD_SIZE];
+static uint8_t sc_word_len = 0;
+
+static const char *const sc_abbreviations[] = {SENTENCE_CASE_ABBREVIATIONS};
+
+bool is_sentence_start(void) {
+    return sc_state == SC_PRIMED;
+}
+
+void sentence_case_reset(void) {
+    sc_state    = SC_IDLE;
+    sc_word_len = 0;
+}
+
+static void word_push(char c) {
+    if (sc_word_len < SENTENCE_CASE_WORD_SIZE) {
+        sc_word[sc_word_len] = c;
+    }
+    if (sc_word_len <= SENTENCE_CASE_WORD_SIZE) {
+        sc_word_len++;
+    }
+}
+
+static bool is_abbreviation(void) {
+    if (sc_word_len == 0 || sc_word_len > SENTENCE_CASE_WORD_SIZE) {
+        return false;
+    }
+    for (uint8_t i = 0; i < ARRAY_SIZE(sc_abbreviations); i++) {
+        if (strlen(sc_abbreviations[i]) == sc_word_len && memcmp(sc_abbreviations[i], sc_word, sc_word_len) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// . ! or ? - only a . can close an abbreviation
+static void sentence_end(bool dot) {
+    if (dot && is_abbreviation()) {
+        sc_state = SC_IDLE;
+    } else if (sc_state != SC_PRIMED) {
+        sc_state = SC_ENDED;  // "?!" and "..." still end one sentence
+    }
+    word_push('.');
+}
+
+static bool sentence_letter(uint16_t kc, bool shifted) {
+    word_push('a' + (kc - KC_A));
+    if (sc_state == SC_PRIMED && !shifted && !is_caps_word_on() && get_case_mode() == CASE_MODE_OFF) {
+        tap_code16(LSFT(kc));
+        sc_state  = SC_CAPPED;
+        sc_capped = kc;
+        return false;
+    }
+    sc_state = SC_IDLE;
+    return true;
+}
+
+static bool sentence_backspace(void) {
+    switch (sc_state) {
+        case SC_CAPPED:
+            // Undo: the capital becomes the letter as typed
+            tap_code(KC_BSPC);
+            tap_code(sc_capped);
+            sc_state = SC_IDLE;
+            return false;
+        case SC_PRIMED:
+            sc_state = SC_ENDED;  // the Space is gone, the terminator is still there
+            break;
+        default:
+            sc_state = SC_IDLE;
+            if (sc_word_len > 0) {
+                sc_word_len--;
+            }
+            break;
+    }
+    return true;
+}
+
+// Process Sentence Case - call from process_record_user()
+bool process_sentence_case(uint16_t keycode, keyrecord_t *record) {
+    if (!record->event.pressed) {
+        return true;
+    }
+
+    uint16_t kc = keycode;
+    if (IS_QK_MOD_TAP(keycode)) {
+        if (record->tap.count == 0) {
+            return true;  // mod-tap held as modifier
+        }
+        kc = QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    }
+
+    uint8_t mods = get_mods() | get_oneshot_mods();
+    if (mods & ~MOD_MASK_SHIFT) {
+        sentence_case_reset();  // shortcut: the text may have changed under us
+        return true;
+    }
+    bool shifted = mods & MOD_MASK_SHIFT;
+
+    switch (kc) {
+        case KC_LCTL ... KC_RGUI:
+        case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+            return true;  // modifiers and layer keys type nothing
+
+        case KC_A ... KC_Z:
+            return sentence_letter(kc, shifted);
+
+        // Alt-symbol morphs: Shift+. is !, Shift+, is ?
+        case KC_DOT:
+#ifdef XC_ALT_BASE_SYMBOLS
+        case AS_DOT:
+#endif
+            sentence_end(!shifted);
+            return true;
+        case KC_COMM:
+#ifdef XC_ALT_BASE_SYMBOLS
+        case AS_COMM:
+#endif
+            if (shifted) {
+                sentence_end(false);
+            } else {
+                sentence_case_reset();
+            }
+            return true;
+        case KC_EXLM:
+        case KC_QUES:
+            sentence_end(false);
+            return true;
+
+        case KC_SPC:
+        case KC_ENT:
+            sc_state    = (sc_state == SC_ENDED || sc_state == SC_PRIMED) ? SC_PRIMED : SC_IDLE;
+            sc_word_len = 0;
+            return true;
+
+        // Quotes and brackets around a sentence keep its end or start pending
+        case KC_QUOT:
+        case KC_DQUO:
+        case KC_LPRN:
+        case KC_RPRN:
+#ifdef XC_ALT_BASE_SYMBOLS
+        case AS_QUOT:
+#endif
+            if (sc_state == SC_CAPPED) {
+                sc_state = SC_IDLE;
+            }
+            return true;
+
+        case KC_BSPC:
+            return sentence_backspace();
+
+        default:
+            sentence_case_reset();
+            return true;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Sentence Case - Capitalize the first letter of a sentence
+ *
+ * A sentence ends with . ! or ? followed by Space (or Enter); the next letter is
+ * then sent shifted. Quotes and opening parentheses in between keep the sentence
+ * start pending. A . that closes a known abbreviation (e.g. i.e. etc.) does not end
+ * the sentence. Backspace right after a capitalized letter undoes it: the capital
+ * is replaced by the lowercase letter, and typing goes on.
+ *
+ * Sentence Case steps aside while Caps Word or a case mode is on, when Shift is
+ * already held (the letter is capitalized anyway) and for shortcuts (Ctrl, Alt or
+ * GUI held).
+ *
+ * Terminators are read the way the alt-symbol morphs produce them (Shift+. is !,
+ * Shift+, is ?), and ! or ? typed from a symbols layer count as well.
+ *
+ * Usage in keymap.c:
+ * 1. XC_SENTENCE_CASE = yes in rules.mk
+ * 2. Call process_sentence_case() in process_record_user(), after the features
+ *    that consume keys (compose, case mode...)
+ */
+
+#ifndef SENTENCE_CASE_ABBREVIATIONS
+// Lowercase, without the final dot
+#    define SENTENCE_CASE_ABBREVIATIONS "e.g", "i.e", "eg", "ie", "etc", "vs", "cf", "mr", "mrs", "ms", "dr", "st"
+#endif
+
+#ifndef SENTENCE_CASE_WORD_SIZE
+#    define SENTENCE_CASE_WORD_SIZE 8  // chars of the current word kept for abbreviations
+#endif
+
+// Process Sentence Case - call from process_record_user()
+// Returns true to continue processing, false if handled (capitalized letter, undo)
+bool process_sentence_case(uint16_t keycode, keyrecord_t *record);
+
+// True when the next letter will be capitalized
+bool is_sentence_start(void);
+
+// Forget the pending sentence start (e.g. on a focus change)
+void sentence_case_reset(void);
@@ -0,0 +1,94 @@
+#include QMK_KEYBOARD_H
+#include "split_sync.h"
+
+#ifdef SPLIT_KEYBOARD
+#    include "transactions.h"
+#endif
+
+/*
+ * Split Sync - Keymap state shared with the slave half
+ *
+ * A failed RPC leaves the synced state stale, so the next housekeeping pass
+ * retries. Savings are tallied per one-second window: every update is a scan that
+ * would have sent sizeof(user_state_t) bytes without change detection.
+ */
+
+static user_state_t user_state;
+
+#ifdef SPLIT_KEYBOARD
+static user_state_t synced;
+static bool         synced_valid = false;
+static uint16_t     synced_time  = 0;
+
+static uint32_t window_start = 0;
+static uint32_t window_scans = 0;
+static uint32_t window_sent  = 0;  // bytes
+static uint16_t bytes_sent   = 0;  // last complete window
+static uint16_t bytes_saved  = 0;
+
+// Slave side of the RPC: the state in, nothing out
+static void split_sync_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    if (in_buflen == sizeof(user_state_t)) {
+        memcpy(&user_state, in_data, sizeof(user_state));
+    }
+}
+#endif
+
+// Register the split RPC - call from keyboard_post_init_user()
+void split_sync_init(void) {
+#ifdef SPLIT_KEYBOARD
+    transaction_register_rpc(RPC_ID_USER_STATE, split_sync_handler);
+#endif
+}
+
+// Publish the master's state - call from housekeeping_task_user()
+void split_sync_update(user_state_t state) {
+    if (!is_keyboard_master()) {
+        return;
+    }
+    user_state = state;
+
+#ifdef SPLIT_KEYBOARD
+    if (!synced_valid || synced.raw != state.raw || timer_elapsed(synced_time) >= SPLIT_SYNC_HEARTBEAT) {
+        if (transaction_rpc_send(RPC_ID_USER_STATE, sizeof(state), &state)) {
+            synced       = state;
+            synced_valid = true;
+            synced_time  = timer_read();
+            window_sent += sizeof(state);
+        }
+    }
+
+    window_scans++;
+    if (timer_elapsed32(window_start) >= 1000) {
+        uint32_t saved = window_scans * sizeof(user_state_t) - window_sent;
+        bytes_saved    = MIN(saved, UINT16_MAX);
+        bytes_sent     = MIN(window_sent, UINT16_MAX);
+        window_start   = timer_read32();
+        window_scans   = 0;
+        window_sent    = 0;
+    }
+#endif
+}
+
+// Shared state: the master's last update, on either half
+user_state_t get_user_state(void) {
+    return user_state;
+}
+
+// Bytes sent over the last second
+uint16_t split_sync_bytes_sent(void) {
+#ifdef SPLIT_KEYBOARD
+    return bytes_sent;
+#else
+    return 0;
+#endif
+}
+
+// Bytes per second not sent thanks to change detection
+uint16_t split_sync_bytes_saved(void) {
+#ifdef SPLIT_KEYBOARD
+    return bytes_saved;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Split Sync - Keymap state shared with the slave half
+ *
+ * Feature state (compose, select latch, swapper, OS, app context...) is only
+ * maintained on the master, where keys are processed. The master packs it into a
+ * user_state_t bitfield and sends it to the slave over a user RPC, but only when it
+ * changes, plus a heartbeat every SPLIT_SYNC_HEARTBEAT so a slave that rebooted
+ * catches up. Either half reads the shared state with get_user_state().
+ *
+ * The module also counts what change detection saves compared with sending the
+ * state on every scan; telemetry reports it.
+ *
+ * Usage in keymap.c:
+ * 1. split_sync.c in SRC (rules.mk), and
+ *    SPLIT_TRANSACTION_IDS_USER RPC_ID_USER_STATE (config.h)
+ * 2. Call split_sync_init() from keyboard_post_init_user()
+ * 3. On the master, call split_sync_update() from housekeeping_task_user() with the
+ *    current state; on both halves, read get_user_state()
+ *
+ * On unsplit keyboards get_user_state() simply returns the last update.
+ */
+
+#ifndef SPLIT_SYNC_HEARTBEAT
+#    define SPLIT_SYNC_HEARTBEAT 1000  // ms between resends of an unchanged state
+#endif
+
+typedef union {
+    uint16_t raw;
+    struct {
+        uint8_t layer : 3;  // highest active layer (0-7)
+        bool    os_mac : 1;
+        bool    compose : 1;
+        bool    sel_latch : 1;
+        bool    caps_word : 1;
+        bool    layer_lock : 1;
+        bool    sw_win : 1;      // any swapper holding its modifier
+        uint8_t context : 2;     // semkey_context_t
+    };
+} user_state_t;
+
+_Static_assert(sizeof(user_state_t) == 2, "user_state_t must stay two bytes on the split link");
+
+// Register the split RPC - call from keyboard_post_init_user()
+void split_sync_init(void);
+
+// Publish the master's state - call from housekeeping_task_user() (ignored on the slave)
+void split_sync_update(user_state_t state);
+
+// Shared state: the master's last update, on either half
+user_state_t get_user_state(void);
+
+// Bytes sent over the last second
+uint16_t split_sync_bytes_sent(void);
+
+// Bytes per second not sent thanks to change detection (versus one send per scan)
+uint16_t split_sync_bytes_saved(void);
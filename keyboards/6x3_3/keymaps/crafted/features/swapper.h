@@ -1,26 +0,0 @@
-#pragma once
-
-#include QMK_KEYBOARD_H
-
-// Implements cmd-tab like behaviour on a single key. On first tap of trigger
-// cmdish is held and tabish is tapped -- cmdish then remains held until some
-// other key is hit or released. For example:
-//
-//     trigger, trigger, a -> cmd down, tab, tab, cmd up, a
-//     nav down, trigger, nav up -> nav down, cmd down, tab, cmd up, nav up
-//
-// If Shift is held while trigger is pressed, sends Shift+Tab for reverse direction.
-//
-// This behaviour is useful for more than just cmd-tab, hence: cmdish, tabish.
-void update_swapper(
-    bool *active,
-    uint16_t cmdish,
-    uint16_t tabish,
-    uint16_t trigger,
-    uint16_t keycode,
-    keyrecord_t *record
-);
-
-// To be implemented by the consumer. Defines keys that should not interrupt
-// the swapper when active (e.g., shift keys for changing direction).
-bool is_swapper_ignored_key(uint16_t keycode);
@@ -0,0 +1,160 @@
+#include QMK_KEYBOARD_H
+#include "telemetry.h"
+#include "key_positions.h"
+#include "split_sync.h"
+
+/*
+ * Telemetry - Rolling typing statistics for tap-hold tuning
+ *
+ * Everything lives in one static block that the host reads verbatim; the only other
+ * state is the last press (for intervals and combo misses) and the press time of
+ * each tracked mod-tap.
+ */
+
+#ifndef COMBO_TERM
+#    define COMBO_TERM 50
+#endif
+
+_Static_assert(sizeof(telemetry_t) == 16 + 2 * (2 * TELEMETRY_MAX_COMBOS + TELEMETRY_INTERVAL_BUCKETS + TELEMETRY_HOLD_POSITIONS * 2 * TELEMETRY_HOLD_BUCKETS), "telemetry_t must not be padded");
+
+static telemetry_t telemetry = {
+    .version        = TELEMETRY_VERSION,
+    .hold_bucket_ms = TELEMETRY_HOLD_BUCKET_MS,
+};
+
+static uint16_t last_press_time    = 0;
+static uint16_t last_press_keycode = KC_NO;  // layer 0 keycode, as combos see it
+static bool     last_press_valid   = false;
+static uint16_t hold_start[TELEMETRY_HOLD_POSITIONS];
+
+static inline void bump16(uint16_t *counter) {
+    if (*counter < UINT16_MAX) {
+        (*counter)++;
+    }
+}
+
+// Mod-tap positions (16/19 GUI, 26-28 and 31-33 bottom-row mods) to histogram slot
+static int8_t hold_slot(uint8_t pos) {
+    switch (pos) {
+        case 16: return 0;
+        case 19: return 1;
+        case 26: return 2;
+        case 27: return 3;
+        case 28: return 4;
+        case 31: return 5;
+        case 32: return 6;
+        case 33: return 7;
+        default: return -1;
+    }
+}
+
+// log2 bucket: 0 ms -> 0, [1, 2) -> 1, [2, 4) -> 2, ... capped at the last bucket
+static uint8_t interval_bucket(uint16_t interval) {
+    uint8_t bucket = 0;
+    while (interval && bucket < TELEMETRY_INTERVAL_BUCKETS - 1) {
+        interval >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+// The term QMK applies to a combo: the keymap's get_combo_term() (tunables) when per combo
+static uint16_t combo_term(uint16_t index) {
+#ifdef COMBO_TERM_PER_COMBO
+    return get_combo_term(index, combo_get(index));
+#else
+    return COMBO_TERM;
+#endif
+}
+
+// Two keys of the same combo pressed within its combo term both reached the keymap
+static void check_combo_miss(uint16_t keycode, uint16_t interval) {
+    uint16_t count = combo_count();
+    if (count > TELEMETRY_MAX_COMBOS) {
+        count = TELEMETRY_MAX_COMBOS;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        const uint16_t *keys   = combo_get(i)->keys;
+        uint16_t        first  = pgm_read_word(&keys[0]);
+        uint16_t        second = pgm_read_word(&keys[1]);
+        if (pgm_read_word(&keys[2]) != COMBO_END) {
+            continue;  // only two-key combos
+        }
+        bool both = (first == keycode && second == last_press_keycode) || (second == keycode && first == last_press_keycode);
+        if (both && interval <= combo_term(i)) {
+            bump16(&telemetry.combo_misses[i]);
+        }
+    }
+}
+
+// Process telemetry - call first in process_record_user()
+bool process_telemetry(uint16_t keycode, keyrecord_t *record) {
+    uint8_t pos  = get_key_position(record->event.key);
+    int8_t  slot = (pos == KEY_POSITION_NONE) ? -1 : hold_slot(pos);
+
+    if (!record->event.pressed) {
+        if (slot >= 0 && (IS_QK_MOD_TAP(keycode) || IS_QK_LAYER_TAP(keycode))) {
+            uint16_t duration = TIMER_DIFF_16(record->event.time, hold_start[slot]);
+            uint16_t bucket   = duration / TELEMETRY_HOLD_BUCKET_MS;
+            if (bucket >= TELEMETRY_HOLD_BUCKETS) {
+                bucket = TELEMETRY_HOLD_BUCKETS - 1;
+            }
+            uint8_t resolution = record->tap.count ? TELEMETRY_TAP : TELEMETRY_HOLD;
+            bump16(&telemetry.holds[slot][resolution][bucket]);
+        }
+        return true;
+    }
+
+    if (telemetry.keypresses < UINT32_MAX) {
+        telemetry.keypresses++;
+    }
+    uint8_t wpm = get_current_wpm();
+    if (wpm > telemetry.wpm_peak) {
+        telemetry.wpm_peak = wpm;
+    }
+    if (slot >= 0) {
+        hold_start[slot] = record->event.time;
+    }
+
+    uint16_t interval = TIMER_DIFF_16(record->event.time, last_press_time);
+    if (last_press_valid) {
+        bump16(&telemetry.intervals[interval_bucket(interval)]);
+    }
+
+    // Combo events and other synthetic records have no position
+    uint16_t base_keycode = (pos == KEY_POSITION_NONE) ? KC_NO : keymap_key_to_keycode(0, record->event.key);
+    if (last_press_valid && base_keycode != KC_NO) {
+        check_combo_miss(base_keycode, interval);
+    }
+
+    last_press_time    = record->event.time;
+    last_press_keycode = base_keycode;
+    last_press_valid   = true;
+    return true;
+}
+
+// Count a combo activation - call from process_combo_event() when pressed
+void telemetry_combo_event(uint16_t combo_index) {
+    if (combo_index < TELEMETRY_MAX_COMBOS) {
+        bump16(&telemetry.combo_hits[combo_index]);
+    }
+}
+
+// Current statistics (rates refreshed on each call)
+const telemetry_t *get_telemetry(void) {
+    telemetry.wpm = get_current_wpm();
+#ifdef DEBUG_MATRIX_SCAN_RATE
+    telemetry.scan_rate = get_matrix_scan_rate();
+#endif
+    telemetry.split_bytes_sent  = split_sync_bytes_sent();
+    telemetry.split_bytes_saved = split_sync_bytes_saved();
+    return &telemetry;
+}
+
+// Clear all accumulators
+void telemetry_reset(void) {
+    memset(&telemetry, 0, sizeof(telemetry));
+    telemetry.version        = TELEMETRY_VERSION;
+    telemetry.hold_bucket_ms = TELEMETRY_HOLD_BUCKET_MS;
+    last_press_valid         = false;
+}
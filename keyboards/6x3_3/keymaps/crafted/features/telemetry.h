@@ -0,0 +1,73 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Telemetry - Rolling typing statistics for tap-hold tuning
+ *
+ * Keeps fixed-size accumulators, updated in constant time per keypress:
+ * - WPM (QMK's WPM feature) and its peak
+ * - matrix scans per second (DEBUG_MATRIX_SCAN_RATE), to measure the cost of RGB and
+ *   other per-scan work
+ * - split link bytes sent per second by Split Sync, and saved by its change detection
+ * - a log2 histogram of the interval between consecutive presses
+ * - press durations of the bottom-row and index mod-taps (positions 16/19/26-28/31-33),
+ *   split by how they resolved (tap or hold), in TELEMETRY_HOLD_BUCKET_MS buckets
+ * - per-combo hits, and misses: both keys of a combo pressed within its combo term (the
+ *   runtime one with COMBO_TERM_PER_COMBO) that still reached the keymap as two separate keys
+ *
+ * Counters saturate instead of wrapping. The host reads the telemetry_t block as-is,
+ * little-endian, through Host Link (see tools/xc_telemetry.py).
+ *
+ * Usage in keymap.c:
+ * 1. WPM_ENABLE = yes and telemetry.c, key_positions.c, split_sync.c in SRC (rules.mk)
+ * 2. Call process_telemetry() first thing in process_record_user()
+ * 3. Call telemetry_combo_event() from process_combo_event() on press
+ */
+
+#define TELEMETRY_VERSION 3
+
+#define TELEMETRY_INTERVAL_BUCKETS 16  // bucket n: interval in [2^(n-1), 2^n) ms, 0 for 0 ms
+#define TELEMETRY_HOLD_POSITIONS   8   // mod-tap positions tracked, see telemetry.c
+#define TELEMETRY_HOLD_BUCKETS     16
+#define TELEMETRY_MAX_COMBOS       8
+
+#ifndef TELEMETRY_HOLD_BUCKET_MS
+#    define TELEMETRY_HOLD_BUCKET_MS 25  // 16 buckets cover 0-400 ms, around TAPPING_TERM
+#endif
+
+enum telemetry_resolution {
+    TELEMETRY_TAP = 0,
+    TELEMETRY_HOLD,
+};
+
+// Fields are ordered so the struct has no padding: the host decodes it as laid out here
+typedef struct {
+    uint8_t  version;  // TELEMETRY_VERSION
+    uint8_t  wpm;
+    uint8_t  wpm_peak;
+    uint8_t  hold_bucket_ms;
+    uint32_t keypresses;
+    uint32_t scan_rate;          // scans per second, 0 without DEBUG_MATRIX_SCAN_RATE
+    uint16_t split_bytes_sent;   // per second, 0 on unsplit keyboards
+    uint16_t split_bytes_saved;  // per second
+    uint16_t combo_hits[TELEMETRY_MAX_COMBOS];
+    uint16_t combo_misses[TELEMETRY_MAX_COMBOS];
+    uint16_t intervals[TELEMETRY_INTERVAL_BUCKETS];
+    uint16_t holds[TELEMETRY_HOLD_POSITIONS][2][TELEMETRY_HOLD_BUCKETS];  // [slot][tap/hold][bucket]
+} telemetry_t;
+
+// Process telemetry - call first in process_record_user()
+// Always returns true: it only observes
+bool process_telemetry(uint16_t keycode, keyrecord_t *record);
+
+// Count a combo activation - call from process_combo_event() when pressed
+void telemetry_combo_event(uint16_t combo_index);
+
+// Current statistics (rates refreshed on each call)
+const telemetry_t *get_telemetry(void);
+
+// Clear all accumulators
+void telemetry_reset(void);
@@ -0,0 +1,164 @@
+#include QMK_KEYBOARD_H
+#include "tunables.h"
+#ifdef SPLIT_KEYBOARD
+#    include "transactions.h"
+#endif
+#ifdef XC_HEATMAP
+#    include "heatmap.h"
+_Static_assert(HEATMAP_EEPROM_SIZE <= TUNABLES_EEPROM_OFFSET, "tunables overlap the heatmap in the user datablock");
+#endif
+
+/*
+ * Tunables - Timing parameters and feature toggles editable without reflashing
+ *
+ * Records are written with eeconfig_update_user_datablock(), which only rewrites the
+ * bytes that changed: a save costs one slot, never the whole ring.
+ *
+ * On a split keyboard the master sends each saved set of values to the other half,
+ * which writes it from tunables_task() rather than from the RPC handler.
+ */
+
+#define TUNABLES_MAGIC 0x5455  // "TU"; bump when a record's layout changes
+
+typedef struct {
+    uint16_t   sequence;  // newer record = higher, modulo 2^16
+    tunables_t values;
+    uint16_t   checksum;  // over sequence and values, seeded with TUNABLES_MAGIC
+} tunables_record_t;
+
+#define TUNABLES_RECORD_OFFSET(slot) (TUNABLES_EEPROM_OFFSET + (slot) * sizeof(tunables_record_t))
+#define TUNABLES_EEPROM_END          TUNABLES_RECORD_OFFSET(TUNABLES_SLOTS)
+
+#ifdef EECONFIG_USER_DATA_SIZE
+_Static_assert(TUNABLES_EEPROM_END <= EECONFIG_USER_DATA_SIZE, "EECONFIG_USER_DATA_SIZE is too small for the tunables");
+#endif
+
+#define TUNABLE_DEFAULT(id, field, value, min, max) value,
+static const uint16_t tunable_defaults[TUNABLE_COUNT] = {TUNABLES_LIST(TUNABLE_DEFAULT)};
+#undef TUNABLE_DEFAULT
+#define TUNABLE_MIN(id, field, value, min, max) min,
+static const uint16_t tunable_min[TUNABLE_COUNT] = {TUNABLES_LIST(TUNABLE_MIN)};
+#undef TUNABLE_MIN
+#define TUNABLE_MAX(id, field, value, min, max) max,
+static const uint16_t tunable_max[TUNABLE_COUNT] = {TUNABLES_LIST(TUNABLE_MAX)};
+#undef TUNABLE_MAX
+
+#define TUNABLE_INIT(id, field, value, min, max) .field = value,
+tunables_t tunables = {TUNABLES_LIST(TUNABLE_INIT)};
+#undef TUNABLE_INIT
+
+static uint8_t  newest_slot     = TUNABLES_SLOTS - 1;  // the first save goes to slot 0
+static uint16_t newest_sequence = 0;
+
+#ifdef SPLIT_KEYBOARD
+static tunables_t    sync_values;             // master: the last save, for the other half
+static bool          sync_pending = false;    // master: not delivered yet
+static uint32_t      sync_time    = 0;        // master: last attempt
+static volatile bool save_pending = false;    // other half: values received, not written yet
+#endif
+
+// Same layout as tunables_t: one uint16_t per id
+static uint16_t *tunable_values(void) {
+    return (uint16_t *)&tunables;
+}
+
+static uint16_t record_checksum(const tunables_record_t *record) {
+    const uint8_t *bytes = (const uint8_t *)record;
+    uint16_t       sum   = TUNABLES_MAGIC;
+    for (uint8_t i = 0; i < offsetof(tunables_record_t, checksum); i++) {
+        sum = (sum << 1 | sum >> 15) ^ bytes[i];  // rotate-xor: catches swapped and zeroed bytes
+    }
+    return sum;
+}
+
+#ifdef SPLIT_KEYBOARD
+// Other half's side of the RPC: the saved values in, nothing out
+static void tunables_sync_handler(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data) {
+    if (in_buflen != sizeof(tunables_t)) {
+        return;
+    }
+    uint16_t values[TUNABLE_COUNT];
+    memcpy(values, in_data, sizeof(values));
+    for (uint8_t id = 0; id < TUNABLE_COUNT; id++) {
+        tunables_set(id, values[id]);  // out of bounds for this build: keep the current value
+    }
+    save_pending = true;
+}
+#endif
+
+void tunables_init(void) {
+#ifdef SPLIT_KEYBOARD
+    transaction_register_rpc(RPC_ID_USER_TUNABLES, tunables_sync_handler);
+#endif
+
+    bool found = false;
+    for (uint8_t slot = 0; slot < TUNABLES_SLOTS; slot++) {
+        tunables_record_t record;
+        eeconfig_read_user_datablock(&record, TUNABLES_RECORD_OFFSET(slot), sizeof(record));
+        if (record.checksum != record_checksum(&record)) {
+            continue;  // never written, or torn
+        }
+        if (!found || (int16_t)(record.sequence - newest_sequence) > 0) {
+            found           = true;
+            newest_slot     = slot;
+            newest_sequence = record.sequence;
+            tunables        = record.values;
+        }
+    }
+
+    // Values the current build doesn't accept fall back to its defaults
+    uint16_t *values = tunable_values();
+    for (uint8_t id = 0; id < TUNABLE_COUNT; id++) {
+        if (values[id] < tunable_min[id] || values[id] > tunable_max[id]) {
+            values[id] = tunable_defaults[id];
+        }
+    }
+}
+
+bool tunables_set(uint8_t id, uint16_t value) {
+    if (id >= TUNABLE_COUNT || value < tunable_min[id] || value > tunable_max[id]) {
+        return false;
+    }
+    tunable_values()[id] = value;
+    return true;
+}
+
+void tunables_reset(void) {
+    memcpy(&tunables, tunable_defaults, sizeof(tunables));
+}
+
+// Append the current values to this half's ring
+static void tunables_write(void) {
+    tunables_record_t record = {
+        .sequence = newest_sequence + 1,
+        .values   = tunables,
+    };
+    record.checksum = record_checksum(&record);
+
+    uint8_t slot = (newest_slot + 1) % TUNABLES_SLOTS;
+    eeconfig_update_user_datablock(&record, TUNABLES_RECORD_OFFSET(slot), sizeof(record));
+    newest_slot     = slot;
+    newest_sequence = record.sequence;
+}
+
+void tunables_save(void) {
+    tunables_write();
+#ifdef SPLIT_KEYBOARD
+    sync_values  = tunables;
+    sync_time    = timer_read32();
+    sync_pending = !transaction_rpc_send(RPC_ID_USER_TUNABLES, sizeof(sync_values), &sync_values);
+#endif
+}
+
+void tunables_task(void) {
+#ifdef SPLIT_KEYBOARD
+    if (save_pending) {
+        save_pending = false;
+        tunables_write();
+    }
+    if (sync_pending && timer_elapsed32(sync_time) >= TUNABLES_SYNC_RETRY) {
+        sync_time    = timer_read32();
+        sync_pending = !transaction_rpc_send(RPC_ID_USER_TUNABLES, sizeof(sync_values), &sync_values);
+    }
+#endif
+}
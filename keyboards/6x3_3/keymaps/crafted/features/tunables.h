@@ -0,0 +1,107 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Tunables - Timing parameters and feature toggles editable without reflashing
+ *
+ * The values live in one RAM struct, loaded once at boot and read directly by the
+ * get_*_term() callbacks. Host Link edits them live (HL_CMD_SET_TUNABLE, see
+ * tools/xc_tune.py); HL_CMD_SAVE_TUNABLES persists them.
+ *
+ * EEPROM layout (user datablock, TUNABLES_EEPROM_OFFSET): a ring of TUNABLES_SLOTS
+ * records, each a sequence number, the values and a checksum. A save writes the
+ * slot after the newest one; boot loads the newest record whose checksum holds.
+ * Saves rotate over the slots, on top of the EEPROM driver's own wear leveling.
+ * A write torn by a power loss only loses that save: the previous record is still
+ * valid. Values out of bounds (e.g. from an older layout) fall back to the build
+ * defaults one by one.
+ *
+ * Each half has its own EEPROM, and only the master is reachable from the host. On a
+ * split keyboard a save is also sent to the other half over a user RPC and written to
+ * its EEPROM too, so either half can be the one plugged in. If the halves are not
+ * connected, the master retries every TUNABLES_SYNC_RETRY until it loses power; after
+ * that, the other half keeps its older values until the next save.
+ *
+ * Feature toggles only switch features off at runtime: a feature left out of the
+ * build has nothing to turn on.
+ *
+ * Usage in keymap.c:
+ * 1. XC_TUNABLES = yes in rules.mk (with XC_HOST_LINK to edit them)
+ * 2. Call tunables_init() from keyboard_post_init_user(): the first key needs them
+ * 3. Read `tunables` from get_tapping_term(), get_flow_tap_term(), get_combo_term()...
+ * 4. On split keyboards: add RPC_ID_USER_TUNABLES to SPLIT_TRANSACTION_IDS_USER
+ *    (config.h) and call tunables_task() from housekeeping_task_user()
+ */
+
+#ifndef TUNABLES_EEPROM_OFFSET
+#    define TUNABLES_EEPROM_OFFSET 0  // in the user datablock
+#endif
+#ifndef TUNABLES_SLOTS
+#    define TUNABLES_SLOTS 4  // records in the ring
+#endif
+#ifndef TUNABLES_SYNC_RETRY
+#    define TUNABLES_SYNC_RETRY 1000  // ms between attempts to send a save to the other half
+#endif
+
+#ifndef FLOW_TAP_TERM
+#    define TUNABLES_FLOW_TAP_TERM 0
+#else
+#    define TUNABLES_FLOW_TAP_TERM FLOW_TAP_TERM
+#endif
+#ifndef SL_HOLD_SHIFT_TIMEOUT
+#    define SL_HOLD_SHIFT_TIMEOUT 200
+#endif
+
+// Feature toggles (TUNABLE_FLAGS)
+enum tunable_flag {
+    TUNABLE_FLAG_WEAK_CORNERS     = 1 << 0,  // weak corner combos (XC_WEAK_CORNERS)
+    TUNABLE_FLAG_ALT_BASE_SYMBOLS = 1 << 1,  // AS_* shift pairs (XC_ALT_BASE_SYMBOLS)
+};
+#define TUNABLE_FLAGS_ALL (TUNABLE_FLAG_WEAK_CORNERS | TUNABLE_FLAG_ALT_BASE_SYMBOLS)
+
+// X(id, field, default, min, max) - append only: ids are the host protocol
+#define TUNABLES_LIST(X) \
+    X(TUNABLE_TAPPING_TERM,  tapping_term,          TAPPING_TERM,           50, 1000) \
+    X(TUNABLE_FLOW_TAP_TERM, flow_tap_term,         TUNABLES_FLOW_TAP_TERM,  0,  500) \
+    X(TUNABLE_COMBO_TERM,    combo_term,            COMBO_TERM,             10,  300) \
+    X(TUNABLE_SL_HOLD_SHIFT, sl_hold_shift_timeout, SL_HOLD_SHIFT_TIMEOUT,  80, 1000) \
+    X(TUNABLE_FLAGS,         flags,                 TUNABLE_FLAGS_ALL,       0, TUNABLE_FLAGS_ALL)
+
+#define TUNABLE_ID(id, field, value, min, max) id,
+typedef enum { TUNABLES_LIST(TUNABLE_ID) TUNABLE_COUNT } tunable_id_t;
+#undef TUNABLE_ID
+
+// One uint16_t per tunable, in id order: no padding, the host decodes it as laid out
+#define TUNABLE_FIELD(id, field, value, min, max) uint16_t field;
+typedef struct {
+    TUNABLES_LIST(TUNABLE_FIELD)
+} tunables_t;
+#undef TUNABLE_FIELD
+
+_Static_assert(sizeof(tunables_t) == TUNABLE_COUNT * sizeof(uint16_t), "tunables_t must be packed");
+
+// Current values - read only, change them with tunables_set()
+extern tunables_t tunables;
+
+// Load the newest saved record (build defaults if none) - call from keyboard_post_init_user()
+void tunables_init(void);
+
+// Change one value in RAM; false if the id is unknown or the value out of bounds
+bool tunables_set(uint8_t id, uint16_t value);
+
+// Back to the build defaults, in RAM
+void tunables_reset(void);
+
+// Append the current values to the EEPROM ring, on both halves of a split keyboard
+void tunables_save(void);
+
+// Finish saves between halves - call from housekeeping_task_user()
+void tunables_task(void);
+
+// True when a runtime toggle is on
+static inline bool is_tunable_flag_on(uint16_t flag) {
+    return tunables.flags & flag;
+}
@@ -0,0 +1,91 @@
+#include QMK_KEYBOARD_H
+#include "word_chords.h"
+#include "key_positions.h"
+
+/*
+ * Word Chords - Whole-word output from chorded alpha keys
+ *
+ * State is a handful of bytes regardless of dictionary size: the bitmask of keys
+ * in the current chord, the keys still down, and how many letters were typed.
+ */
+
+static uint64_t chord_keys     = 0;      // positions pressed since the chord started
+static uint64_t chord_down     = 0;      // positions still held
+static uint16_t chord_start    = 0;      // event time of the first press
+static uint8_t  chord_typed    = 0;      // letters emitted by the chord's keys
+static bool     chord_valid    = false;  // still a candidate (no roll, no hold, in time)
+static bool     chord_released = false;  // a key went up: no more keys may join
+
+// Binary search over the sorted PROGMEM dictionary
+static const char *word_chord_lookup(uint64_t keys) {
+    uint16_t lo = 0;
+    uint16_t hi = word_chords_count;
+    while (lo < hi) {
+        uint16_t     mid = lo + (hi - lo) / 2;
+        word_chord_t entry;
+        memcpy_P(&entry, &word_chords[mid], sizeof(entry));
+        if (entry.keys == keys) {
+            return entry.word;
+        }
+        if (entry.keys < keys) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return NULL;
+}
+
+// Letters typed by the chord become the word
+static void word_chord_resolve(void) {
+    const char *word = word_chord_lookup(chord_keys);
+    if (word == NULL) {
+        return;
+    }
+    for (uint8_t i = 0; i < chord_typed; i++) {
+        tap_code(KC_BSPC);
+    }
+    send_string(word);
+}
+
+// Process word chords - call from process_record_user()
+bool process_word_chords(uint16_t keycode, keyrecord_t *record) {
+    uint8_t pos = get_key_position(record->event.key);
+    if (pos >= 36) {
+        return true;  // thumbs and unknown positions never take part in chords
+    }
+    uint64_t bit = CHORD_POS(pos);
+
+    if (!record->event.pressed) {
+        if (chord_down & bit) {
+            chord_down &= ~bit;
+            chord_released = true;
+            if (chord_down == 0 && chord_valid && chord_typed >= 2) {
+                word_chord_resolve();
+            }
+        }
+        return true;
+    }
+
+    // A chord is a set of plain letters typed on a base layer
+    uint16_t kc = keycode;
+    if (IS_QK_MOD_TAP(keycode)) {
+        kc = (record->tap.count == 0) ? KC_NO : QK_MOD_TAP_GET_TAP_KEYCODE(keycode);
+    }
+    bool letter = (layer_state == 0) && kc >= KC_A && kc <= KC_Z;
+
+    if (chord_down == 0) {
+        chord_keys     = 0;
+        chord_typed    = 0;
+        chord_start    = record->event.time;
+        chord_valid    = letter;
+        chord_released = false;
+    } else if (!letter || chord_released || TIMER_DIFF_16(record->event.time, chord_start) > WORD_CHORD_TERM) {
+        chord_valid = false;  // a roll, a held mod-tap or a non-letter: plain typing
+    }
+
+    chord_keys |= bit;
+    chord_down |= bit;
+    chord_typed++;
+    return true;
+}
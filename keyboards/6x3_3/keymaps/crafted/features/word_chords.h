@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Word Chords - Whole-word output from chorded alpha keys
+ *
+ * Press several alpha keys together (all down before any is released, all within
+ * WORD_CHORD_TERM of the first) and the letters they typed are replaced by a word.
+ * Unlike QMK combos, keys are never held back: normal typing has no added latency,
+ * and a chord is resolved once, on the last release, by a binary search over a
+ * PROGMEM dictionary keyed by position bitmask. Cost per chord is O(log n) and
+ * there is no per-chord RAM, so hundreds of chords are fine.
+ *
+ * Chords are only tracked on the base layers (no momentary layer active).
+ *
+ * Usage in keymap.c:
+ * 1. Add word_chords.c and key_positions.c to SRC in rules.mk
+ * 2. Define word_chords[] (sorted by keys, ascending) and word_chords_count
+ * 3. Call process_word_chords() in process_record_user() before features that
+ *    may swallow letter keys
+ */
+
+#ifndef WORD_CHORD_TERM
+#    define WORD_CHORD_TERM 40  // ms between the first and the last key of a chord
+#endif
+
+// Position bit for the chord dictionary (abstract _XX_ positions 0-35)
+#define CHORD_POS(p) (1ULL << (p))
+
+typedef struct {
+    uint64_t    keys;  // CHORD_POS() bits of the chord
+    const char *word;  // text typed in place of the chord's letters
+} word_chord_t;
+
+#define WORD_CHORD(k, w) {.keys = (k), .word = (w)}
+
+// To be defined by the consumer, sorted by keys (ascending)
+extern const word_chord_t word_chords[];
+extern const uint16_t     word_chords_count;
+
+// Process word chords - call from process_record_user()
+// Always returns true: letters are typed normally and corrected on a chord match
+bool process_word_chords(uint16_t keycode, keyrecord_t *record);
@@ -0,0 +1,8 @@
+#pragma once
+
+// Edge Matrix: per-pin PAL interrupts (features/edge_matrix.h)
+#ifdef XC_EDGE_MATRIX
+#    define PAL_USE_CALLBACKS TRUE
+#endif
+
+#include_next <halconf.h>
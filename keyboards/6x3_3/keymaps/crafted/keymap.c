@@ -45,30 +45,71 @@
 // Weak corners feature
 #include "feature_weak_corners.h"
 
-// Callum-style swapper
-#include "features/swapper.h"
-
-// OS control for platform-aware features
-#include "features/os_control.h"
-
 enum layers {
     BASE = 0,
     BASE_ALT,
     FAVS,
     SYMBOLS,
     NAV_DEL,
-    ADJUST
+    ADJUST,
+    MOUSE
 };
 
-// Include semantic keys header
-#include "features/semantic_keys.h"
+// Count prefix and the output queue that batches its repeats
+#include "features/output_queue.h"
+#include "features/count_prefix.h"
+
+// Num Word (auto-exiting numbers layer)
+#include "features/num_word.h"
+
+// Case mode (snake_case / kebab-case / camelCase), shares Caps Word's word boundaries
+#include "features/case_mode.h"
+
+#ifdef XC_SENTENCE_CASE
+#    include "features/sentence_case.h"
+#endif
+
+// Host link (raw HID commands from the tools/ scripts)
+#ifdef XC_HOST_LINK
+#    include "features/host_link.h"
+#endif
+
+#ifdef XC_TELEMETRY
+#    include "features/telemetry.h"
+#endif
+
+#ifdef XC_HEATMAP
+#    include "features/heatmap.h"
+#endif
 
-// Include dead keys header
-#include "features/dead_keys.h"
+// Feature state shared with the slave half
+#include "features/split_sync.h"
 
-// Include alternative symbols header
-#include "features/alt_symbols.h"
-#include "features/alt_symbols_layer.h"
+// Matrix to _XX_ position (per-column hold-to-shift timeouts)
+#include "features/key_positions.h"
+
+// Boot-phase timestamps, non-critical init deferred until USB is up
+#include "features/boot_profile.h"
+
+#ifdef XC_INDICATORS
+#    include "features/indicators.h"
+#endif
+
+// Dynamic macros: recorded output, replayed through the output queue
+#ifdef XC_MACRO_RECORDER
+#    include "features/macro_recorder.h"
+#endif
+
+// Timing parameters and feature toggles editable from the host
+#ifdef XC_TUNABLES
+#    include "features/tunables.h"
+#endif
+
+// Word chords (whole words from chorded alpha keys)
+#ifdef XC_WORD_CHORDS
+#    include "features/word_chords.h"
+#    include "feature_word_chords.h"
+#endif
 
 // Combo indices — must match key_combos[] order exactly
 enum combo_events {
@@ -88,6 +129,14 @@ combo_t key_combos[] = {
     XC_WEAK_CORNERS_COMBOS       // COMBO_WC_TL/TR/BL/BR (when XC_WEAK_CORNERS)
 };
 
+// Swappers on FAVS: modifier per OS, keys that keep the swap going, idle release
+swapper_t swappers[] = {
+    SWAPPER(SW_WIN,  KC_LGUI, KC_LALT, KC_TAB, SWAPPER_IGNORE_SHIFT | SWAPPER_IGNORE_ARROWS | SWAPPER_IGNORE_USER, SWAPPER_IDLE_TIMEOUT),
+    SWAPPER(SW_TAB,  KC_LCTL, KC_LCTL, KC_TAB, SWAPPER_IGNORE_SHIFT | SWAPPER_IGNORE_USER, SWAPPER_IDLE_TIMEOUT),
+    SWAPPER(SW_APPW, KC_LGUI, KC_LALT, KC_GRV, SWAPPER_IGNORE_SHIFT | SWAPPER_IGNORE_USER, SWAPPER_IDLE_TIMEOUT),
+};
+const uint8_t swapper_count = ARRAY_SIZE(swappers);
+
 #ifdef XC_WEAK_CORNERS
 // Runtime lookup: [layer][corner] — TL=0, TR=1, BL=2, BR=3
 static const uint16_t wc_keycodes[][4] = {
@@ -101,6 +150,20 @@ static const uint16_t wc_keycodes[][4] = {
 #   include "feature_layout_switch.h"
 #endif
 
+// Shifted pairs on the SYMBOLS layer, shared by the key overrides and hold-to-shift
+#define SL_PAIRS(X) \
+    X(SL_AT,   KC_AT,   KC_HASH)  /* @ → # */            \
+    X(SL_GRV,  KC_GRV,  KC_TILD)  /* ` → ~ */            \
+    X(SL_EQL,  KC_EQL,  KC_PLUS)  /* = → + */            \
+    X(SL_DLR,  KC_DLR,  KC_PERC)  /* $ → % */            \
+    X(SL_AMPR, KC_AMPR, KC_ASTR)  /* & → * */            \
+    X(SL_BSLS, KC_BSLS, KC_CIRC)  /* \ → ^ */            \
+    X(SL_LPRN, KC_LPRN, KC_LT)    /* ( → < */            \
+    X(SL_RPRN, KC_RPRN, KC_GT)    /* ) → > */            \
+    X(SL_LBRC, KC_LCBR, KC_LBRC)  /* { → [ (inverted) */ \
+    X(SL_RBRC, KC_RCBR, KC_RBRC)  /* } → ] (inverted) */ \
+    X(SL_SCLN, KC_COLN, KC_SCLN)  /* : → ; (inverted) */
+
 // Key Overrides for alternative base symbols (custom keycodes)
 
 const key_override_t* key_overrides[] = {
@@ -113,20 +176,18 @@ const key_override_t* key_overrides[] = {
     ALT_SYMBOL_OVERRIDE(AS_UNDS, KC_UNDS, KC_PIPE), // _ → |
 #endif
     // Shifted pairs on the SYMBOLS layer
-    SL_OVERRIDE(SL_AT,   KC_AT,   KC_HASH), // @ → #
-    SL_OVERRIDE(SL_GRV,  KC_GRV,  KC_TILD), // ` → ~
-    SL_OVERRIDE(SL_EQL,  KC_EQL,  KC_PLUS), // = → +
-    SL_OVERRIDE(SL_DLR,  KC_DLR,  KC_PERC), // $ → %
-    SL_OVERRIDE(SL_AMPR, KC_AMPR, KC_ASTR), // & → *
-    SL_OVERRIDE(SL_BSLS, KC_BSLS, KC_CIRC), // \ → ^
-    SL_OVERRIDE(SL_LPRN, KC_LPRN, KC_LT),   // ( → <
-    SL_OVERRIDE(SL_RPRN, KC_RPRN, KC_GT),   // ) → >
-    SL_OVERRIDE(SL_LBRC, KC_LCBR, KC_LBRC), // { → [ (inverted)
-    SL_OVERRIDE(SL_RBRC, KC_RCBR, KC_RBRC), // } → ] (inverted)
-    SL_OVERRIDE(SL_SCLN, KC_COLN, KC_SCLN), // : → ; (inverted)
+    SL_PAIRS(SL_OVERRIDE_ROW)
     NULL
 };
 
+#ifdef XC_SL_HOLD_SHIFT
+// The same pairs, typed shifted when the key is held (no Shift thumb on SYMBOLS)
+const sl_pair_t sl_pairs[] = {
+    SL_PAIRS(SL_PAIR_ROW)
+};
+const uint8_t sl_pair_count = ARRAY_SIZE(sl_pairs);
+#endif
+
 // Chordal Hold handedness: 'L'=left, 'R'=right, '*'=exempt (thumbs)
 const char chordal_hold_layout[MATRIX_ROWS][MATRIX_COLS] PROGMEM =
     LAYOUT_split_3x6_3(
@@ -143,7 +204,7 @@ static const uint16_t gui_morph_r_pri = RGUI_T(_19_);
 const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
      /*
       * ┌───┬───┬───┬───┬───┬───┐       ┌───┬───┬───┬───┬───┬───┐
-      * │   │[Q]│ W[Q]E │ R │ T │       │ Y │ U | I[P]O │[P]│   │
+      * │NW │[Q]│ W[Q]E │ R │ T │       │ Y │ U | I[P]O │[P]│   │
       * ├───┼───┼───┼───┼───┼───┤       ├───┼───┼───┼───┼───┼───┤
       * │Tab│ A │ S │ D │F/⌘│ G │       │ H │J/⌘│ K │ L │ ; │Bsp│
       * ├───┼───┼───┼───┼───┼───┤       ├───┼───┼───┼───┼───┼───┤
@@ -154,7 +215,8 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
       *               └───┤Sft├───┐   ┌───┤Spc├───┘
       *                   └───┤FAV│   │SYM├───┘       FAV=FAVS layer, SYM=SYMBOLS layer
       *                       └───┘   └───┘
-      * CW=Caps Word toggle, _=XC_UNDS (_ → | shifted), Esc/Ent on outer thumbs
+      * CW=Caps Word toggle, NW=Num Word (SYMBOLS until the first non-numeric key, like
+      * Caps Word), _=XC_UNDS (_ → | shifted), Esc/Ent on outer thumbs
       * Esc/Ent/CW/_ fall through on FAVS and SYMBOLS (transparent at 24/35/36/41)
       * Sft/Spc are plain keys; tapping both together (combo) arms Compose for accents:
       * E/A/U/O = acute/grave/diaeresis/circumflex dead key, C=ç, N=ñ, W=€, Esc cancels,
@@ -166,7 +228,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
       * Combos: W+E→Q I+O→P C+V→B M+,→N (when weak corners on); boot lives on ADJUST
       */
     [BASE] = LAYOUT_split_3x6_3(
-        KC_NO,    _01_,    _02_,    _03_,    _04_,    _05_,                               _06_,    _07_,    _08_,    _09_,    _10_,    KC_NO,
+        NW_TOGG,  _01_,    _02_,    _03_,    _04_,    _05_,                               _06_,    _07_,    _08_,    _09_,    _10_,    KC_NO,
         KC_TAB,  _13_,    _14_,    _15_,    LGUI_T(_16_), _17_,                           _18_,    RGUI_T(_19_), _20_,    _21_,    _22_,    KC_BSPC,
         CW_TOGG, _25_,    LALT_T(_26_), LGUI_T(_27_), LCTL_T(_28_), _29_,               _30_,    RCTL_T(_31_), RGUI_T(_32_KC), RALT_T(_33_KC), _34_, XC_UNDS,
                                             KC_ESC,  KC_LSFT, MO(FAVS),               MO(SYMBOLS), KC_SPC,  KC_ENT
@@ -178,7 +240,7 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 #   define XC_LAYOUT_SWITCH_TARGET XC_SECONDARY_LAYOUT
 #   include "feature_layout_switch.h"
     [BASE_ALT] = LAYOUT_split_3x6_3(
-        KC_NO,   _01_,    _02_,    _03_,    _04_,    _05_,                               _06_,    _07_,    _08_,    _09_,    _10_,    KC_NO,
+        NW_TOGG, _01_,    _02_,    _03_,    _04_,    _05_,                               _06_,    _07_,    _08_,    _09_,    _10_,    KC_NO,
         KC_TAB,  _13_,    _14_,    _15_,    LGUI_T(_16_), _17_,                           _18_,    RGUI_T(_19_), _20_,    _21_,    _22_,    KC_BSPC,
         CW_TOGG, _25_,    LALT_T(_26_), LGUI_T(_27_), LCTL_T(_28_), _29_,               _30_,    RCTL_T(_31_), RGUI_T(_32_KC), RALT_T(_33_KC), _34_, XC_UNDS,
                                             KC_ESC,  KC_LSFT, MO(FAVS),               MO(SYMBOLS), KC_SPC,  KC_ENT
@@ -187,11 +249,11 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
       * FAVS Layer (Layer 2) - Favorite shortcuts and navigation
       * WASD-style inverted-T arrows; magnitude grows away from home row (line above, word below)
       * ┌───┬───┬───┬───┬───┬───┐       ┌───┬───┬───┬───┬───┬───┐
-      * │   │   │   │   │   │   │       │PgU│L← │ ↑ │L→ │   │   │
+      * │   │   │Ms⊙│Rec│Ply│STb│       │PgU│L← │ ↑ │L→ │[l]│   │
       * ├───┼───┼───┼───┼───┼───┤       ├───┼───┼───┼───┼───┼───┤
-      * │Esc│Lck│Dl⊙│Sl⊙│G/C│SWn│       │PgD│ ← │ ↓ │ → │   │Del│
+      * │Esc│Lck│Dl⊙│Sl⊙│G/C│SWn│       │PgD│ ← │ ↓ │ → │[¶]│Del│
       * ├───┼───┼───┼───┼───┼───┤       ├───┼───┼───┼───┼───┼───┤
-      * │   │Udo│Cut│Cpy│Pst│   │       │   │W← │   │W→ │   │   │
+      * │   │Udo│Cut│Cpy│Pst│SAp│       │   │W← │[w]│W→ │   │   │
       * └───┴───┴───┴───┴───┴───┘       └───┴───┴───┴───┴───┴───┘
       *               ┌───┐                   ┌───┐
       *               │ ▽ ├───┐           ┌───┤ ▽ │
@@ -201,29 +263,35 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
       * Thumbs ▽ = base Esc / Shift / Space / Enter (36/37/40/41)
       * G/C=MM_GUICTRL: plain momentary GUI (macOS) / Ctrl (Linux) — same index finger
       * as the BASE T-morph, so the modifier lives on one finger across layers
-      * SWn=Switch Window
+      * SWn/STb/SAp=Switch Window (Cmd-Tab / Alt-Tab), Tab (Ctrl-Tab), window of the same App
+      * (Cmd-` / Alt-`): tap repeatedly with the modifier kept held, Shift reverses; the
+      * modifier is let go on any other key or after SWAPPER_IDLE_TIMEOUT
+      * Rec/Ply=Macro recorder: Rec starts/stops recording the output, Ply replays it through
+      * the output queue (Shift: second slot; N× then Ply: N times)
       * Lck=Layer Lock (keep FAVS without holding the thumb)
-      * Sl⊙=Select latch: tap to hold Shift until FAVS is released (or tap again/Esc)
+      * Sl⊙=Select latch: tap to hold Shift until FAVS is released (or tap again/Esc/clipboard)
+      * [w]/[l]/[¶]=Select word, line, paragraph, then latch: motions extend the selection
       * Dl⊙=Delete hold: momentary NAV_DEL sub-layer (hold-only, destructive op)
+      * Ms⊙=Mouse hold: momentary MOUSE sub-layer, on the same finger as Dl⊙
       * L←=Line Begin, L→=Line End, W←=Word Left, W→=Word Right
       * PgU/PgD=vertical pair on inner column (doc begin/end dropped)
       */
     [FAVS] = LAYOUT_split_3x6_3(
-        KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO,   KC_NO,                              KC_PGUP, SK_LINEBEG, KC_UP, SK_LINEEND, KC_NO,   KC_NO,
-        KC_ESC,  QK_LLCK, MO(NAV_DEL), SEL_LATCH, MM_GUICTRL, SW_WIN,                    KC_PGDN, KC_LEFT, KC_DOWN, KC_RGHT, KC_NO,   KC_DEL,
-        _______, SK_UNDO, SK_CUT,  SK_COPY, SK_PSTE, KC_NO,                              KC_NO,   SK_WORDPRV, KC_NO, SK_WORDNXT, KC_NO,   _______,
+        KC_NO,   KC_NO,   MO(MOUSE), MR_REC, MR_PLY,  SW_TAB,                             KC_PGUP, SK_LINEBEG, KC_UP, SK_LINEEND, SK_SELLINE, KC_NO,
+        KC_ESC,  QK_LLCK, MO(NAV_DEL), SEL_LATCH, MM_GUICTRL, SW_WIN,                    KC_PGDN, KC_LEFT, KC_DOWN, KC_RGHT, SK_SELPARA, KC_DEL,
+        _______, SK_UNDO, SK_CUT,  SK_COPY, SK_PSTE, SW_APPW,                            KC_NO,   SK_WORDPRV, SK_SELWORD, SK_WORDNXT, KC_NO, _______,
                                             _______, _______, KC_NO,                  _______, _______, _______
     ),
      /*
       * Layer 3 - SYMBOLS: numpad on the left, symbol field on the right
       * ┌───┬───┬───┬───┬───┬───┐       ┌───┬───┬───┬───┬───┬───┐
-      * │   │```│ 7 │ 8 │ 9 │   │       │ ` │ { │ = │ } │ ' │   │
+      * │   │```│ 7 │ 8 │ 9 │a_b│       │ ` │ { │ = │ } │ ' │   │
       * │   │   │   │   │   │   │       │ ~ │ [ │ + │ ] │ " │   │
       * ├───┼───┼───┼───┼───┼───┤       ├───┼───┼───┼───┼───┼───┤
       * │ ▽ │Lck│ 4 │ 5 │ 6 │ 0 │       │ \ │ ( │ @ │ ) │ : │Bsp│
       * │   │   │   │   │   │   │       │ ^ │ < │ # │ > │ ; │   │
       * ├───┼───┼───┼───┼───┼───┤       ├───┼───┼───┼───┼───┼───┤
-      * │ ▽ │→ ⇒│ 1 │ 2 │ 3 │   │       │ $ │ & │ , │ . │ - │ ▽ │
+      * │ ▽ │→ ⇒│ 1 │ 2 │ 3 │ N×│       │ $ │ & │ , │ . │ - │ ▽ │
       * │   │   │   │   │   │   │       │ % │ * │ ? │ ! │ / │   │
       * └───┴───┴───┴───┴───┴───┘       └───┴───┴───┴───┴───┴───┘
       *               ┌───┐                   ┌───┐
@@ -235,14 +303,18 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
       * middle finger keeps high-frequency =/@; pairs stacked by kind ({[ over (<, }] over )>)
       * , . - ' _ sit on their BASE positions (cross-layer consistency); inverted pairs kept
       * ```=code fence macro, →⇒=tap "->" / shift "=>"
+      * a_b=case mode: tap, then S/_ snake_case, K/- kebab-case, P path/case, C camelCase;
+      * Space types the separator until a word break, Space twice ends it (Caps Word: SCREAMING)
+      * N×=count prefix: tap, type a count on the numpad, then a FAVS motion or NAV_DEL
+      * deletion repeats that many times (e.g. N× 5, hold Dl⊙, DlW = delete 5 words)
       * Lck=Layer Lock: tap to lock (then release MO; 40 ▽ then gives Space), tap again to unlock
       * (M)=held MO(SYMBOLS) thumb, ▽=fall-through to base (Tab, CW_TOGG, XC_UNDS _/|,
       * and thumbs Esc/Shift/Space/Ent — same pattern as FAVS)
       */
     [SYMBOLS] = LAYOUT_split_3x6_3(
-        KC_NO,     MD_FENCE, KC_7,     KC_8,     KC_9,    KC_NO,                              SL_GRV,  SL_LBRC, SL_EQL,   SL_RBRC,  XC_QUOT,  KC_NO,
+        KC_NO,     MD_FENCE, KC_7,     KC_8,     KC_9,    CASE_MD,                            SL_GRV,  SL_LBRC, SL_EQL,   SL_RBRC,  XC_QUOT,  KC_NO,
         _______,   QK_LLCK,  KC_4,     KC_5,     KC_6,    KC_0,                               SL_BSLS, SL_LPRN, SL_AT,    SL_RPRN,  SL_SCLN,  KC_BSPC,
-        _______,   ARROW_OP, KC_1,     KC_2,     KC_3,    KC_NO,                              SL_DLR,  SL_AMPR, XC_COMM,  XC_DOT,   XC_MINS,  _______,
+        _______,   ARROW_OP, KC_1,     KC_2,     KC_3,    CNT_PFX,                            SL_DLR,  SL_AMPR, XC_COMM,  XC_DOT,   XC_MINS,  _______,
                                                   _______, _______, _______,                  KC_NO,   _______, _______
     ),
      /*
@@ -287,6 +359,33 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
         QK_BOOT, SW_OS,   KC_NO,   KC_NO,   KC_NO,   KC_F11,                             KC_F12,  KC_MUTE, KC_VOLU, KC_BRIU, SW_LYT,  _______,
         KC_NO,   PR_OS,   KC_NO,   KC_NO,   KC_NO,   KC_NO,                              KC_NO,   KC_PSCR, KC_VOLD, KC_BRID, PR_LYT,  KC_NO,
                                             _______, _______, _______,                  _______, _______, _______
+    ),
+     /*
+      * MOUSE Layer (Layer 6) - Pointer sub-layer, active only while Ms⊙ is held on FAVS
+      * Cursor on the FAVS arrows, scroll on the page and line keys, buttons under the left fingers
+      * ┌───┬───┬───┬───┬───┬───┐       ┌───┬───┬───┬───┬───┬───┐
+      * │   │   │(▽)│   │   │   │       │Wh↑│Wh←│ ↑ │Wh→│   │   │
+      * ├───┼───┼───┼───┼───┼───┤       ├───┼───┼───┼───┼───┼───┤
+      * │ ▽ │ ✗ │ ✗ │Bt2│Bt1│Bt3│       │Wh↓│ ← │ ↓ │ → │   │ ▽ │
+      * ├───┼───┼───┼───┼───┼───┤       ├───┼───┼───┼───┼───┼───┤
+      * │   │ ▽ │ ▽ │ ▽ │ ▽ │   │       │   │ ▽ │   │ ▽ │   │   │
+      * └───┴───┴───┴───┴───┴───┘       └───┴───┴───┴───┴───┴───┘
+      *               ┌───┐                   ┌───┐
+      *               │ ▽ ├───┐           ┌───┤ ▽ │
+      *               └───┤ ▽ ├───┐   ┌───┤Fst├───┘
+      *                   └───┤   │   │Prc├───┘
+      *                       └───┘   └───┘
+      * Bt1/Bt2/Bt3=left/right/middle click; ▽=FAVS stays live (Esc, Undo and clipboard,
+      * Sl⊙ latched before entering makes clicks Shift-clicks)
+      * Prc/Fst=hold for precise/fast pointer and scroll speeds (kinetic curve in config.h)
+      * ✗=blocked: Lck (would lock FAVS, not MOUSE), Dl⊙
+      * (▽)=Ms⊙ itself (the held MO key)
+      */
+    [MOUSE] = LAYOUT_split_3x6_3(
+        _______, _______, _______, _______, _______, _______,                            MS_WHLU, MS_WHLL, MS_UP,   MS_WHLR, _______, _______,
+        _______, XXXXXXX, XXXXXXX, MS_BTN2, MS_BTN1, MS_BTN3,                            MS_WHLD, MS_LEFT, MS_DOWN, MS_RGHT, _______, _______,
+        _______, _______, _______, _______, _______, _______,                            _______, _______, _______, _______, _______, _______,
+                                            _______, _______, _______,                  MS_ACL0, MS_ACL2, _______
     )
 };
 
@@ -297,12 +396,16 @@ static const uint16_t gui_morph_r_sec = RGUI_T(_19_);
 // Compose state: armed by the Shift+Space thumb combo, consumed by the next keypress
 static bool compose_pending = false;
 
-// Swapper state
-static bool sw_win_active = false;
-
 // Select latch state: real Shift, scoped to the FAVS layer
 static bool sel_latch_active = false;
 
+static void sel_latch_on(void) {
+    if (!sel_latch_active) {
+        register_code(KC_LSFT);
+        sel_latch_active = true;
+    }
+}
+
 static void sel_latch_off(void) {
     if (sel_latch_active) {
         unregister_code(KC_LSFT);
@@ -310,9 +413,46 @@ static void sel_latch_off(void) {
     }
 }
 
+// Selection engine: SK_SEL* select the unit around the cursor in one batch, then latch
+// Shift so the FAVS motions extend it (W←/W→ by word, L←/L→ to the line ends...).
+// Commands acting on the selection drop the latch first, or they'd be sent shifted.
+static bool process_selection(uint16_t keycode, keyrecord_t *record) {
+    switch (keycode) {
+        case SK_SELWORD:
+        case SK_SELLINE:
+        case SK_SELPARA:
+            if (record->event.pressed) {
+                sel_latch_off();
+                uint8_t mods = get_mods();
+                clear_mods();  // the sequences have their own Shift
+                tap_semkey_code(keycode);
+                set_mods(mods);
+                sel_latch_on();
+            }
+            return false;
+
+        case SK_UNDO:
+        case SK_CUT:
+        case SK_COPY:
+        case SK_PSTE:
+            if (record->event.pressed) {
+                sel_latch_off();
+            }
+            return true;
+
+        default:
+            return true;
+    }
+}
+
 layer_state_t layer_state_set_user(layer_state_t state) {
-    // ADJUST tri-layer: active while both FAVS and SYMBOLS are held
-    state = update_tri_layer_state(state, FAVS, SYMBOLS, ADJUST);
+    // ADJUST tri-layer: active while both FAVS and SYMBOLS are held. Num Word turns
+    // SYMBOLS on without its thumb, so holding FAVS then is not the tri-layer chord
+    if (is_num_word_on()) {
+        state &= ~((layer_state_t)1 << ADJUST);
+    } else {
+        state = update_tri_layer_state(state, FAVS, SYMBOLS, ADJUST);
+    }
 
     // Latch lifecycle: released on leaving FAVS; delete hold (NAV_DEL) wins over select
     if (!layer_state_cmp(state, FAVS) || layer_state_cmp(state, NAV_DEL)) {
@@ -321,10 +461,55 @@ layer_state_t layer_state_set_user(layer_state_t state) {
     return state;
 }
 
+// Emit the rest of the output queue, and of a macro replay, before the key being pressed
+static void flush_queued_output(void) {
+    while (output_queue_busy()) {
+        output_queue_flush();
+#ifdef XC_MACRO_RECORDER
+        macro_recorder_task();  // refills the queue while the replay has taps left
+#endif
+    }
+}
+
 bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    process_boot_profile(keycode, record);
+
+    // Queued taps (counted motions, replays) drain from housekeeping; a key typed
+    // meanwhile must not overtake them, nor its modifiers apply to them
+    if (record->event.pressed) {
+        flush_queued_output();
+    }
+
+    // Observers count physical keys: not the base-layer tap replayed for a Num Word terminator
+    if (!is_num_word_replaying()) {
+#ifdef XC_TELEMETRY
+        // Telemetry observes every key before any feature can swallow it
+        process_telemetry(keycode, record);
+#endif
+#ifdef XC_HEATMAP
+        process_heatmap(keycode, record);
+#endif
+    }
+
+#ifdef XC_WORD_CHORDS
+    // Word chords watch every base-layer letter (never swallow it), so they come first
+    process_word_chords(keycode, record);
+#endif
+
+    // Hold-to-shift on SYMBOLS: a held SL_* key types its shifted partner. Before any
+    // feature that swallows keys, so a roll settles the held key first. No new key is
+    // held back during Num Word: its terminators are re-resolved to the base layer
+    // (the NW_TOGG press that started it already settled any pending key).
+    if ((!is_num_word_on() || !record->event.pressed) && !process_sl_hold_shift(keycode, record)) {
+        return false;  // SL_* key pending, or its release
+    }
+
     // Compose (accents): the next key picks a dead key or special character.
     // Unlike the old Leader, unmatched keys pass through unchanged.
     if (compose_pending && record->event.pressed) {
+#ifdef XC_SENTENCE_CASE
+        sentence_case_reset();  // the composed character is not seen as a letter
+#endif
         uint16_t kc = keycode;
         if (IS_QK_MOD_TAP(keycode)) {
             if (record->tap.count == 0) {
@@ -352,18 +537,54 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
         }
     }
 
+    // Num Word: digits and separators keep SYMBOLS on, anything else turns it off
+    if (!process_num_word(keycode, record, SYMBOLS)) {
+        return false;  // Toggle or re-resolved terminator was handled
+    }
+
+    // Count prefix: digits after CNT_PFX build a count, the next motion is repeated
+    if (!process_count_prefix(keycode, record)) {
+        return false;  // Count digit or counted motion was handled
+    }
+
+#ifdef XC_MACRO_RECORDER
+    // Macro recorder: MR_REC / MR_PLY (counted replays come through count_prefix_user())
+    if (!process_macro_recorder(keycode, record)) {
+        return false;  // Record toggle or replay was handled
+    }
+#endif
+
+    // Case mode: Space becomes the identifier separator until a word break
+    if (!process_case_mode(keycode, record)) {
+        return false;  // Mode picker or rewritten Space was handled
+    }
+
+#ifdef XC_SENTENCE_CASE
+    // Sentence case: the first letter after ". " (or "! ", "? ") is shifted
+    if (!process_sentence_case(keycode, record)) {
+        return false;  // Capitalized letter or undo was handled
+    }
+#endif
+
     // Process dead keys FIRST (before semantic keys and oneshots)
     if (!process_dead_key(keycode, record)) {
         return false;  // Dead key was handled
     }
 
+    // Selections: SK_SEL* and the clipboard, around the select latch
+    if (!process_selection(keycode, record)) {
+        return false;  // Selection was sent
+    }
+
     // Process semantic keys (platform-independent editing commands)
     if (!process_semkey(keycode, record)) {
         return false;  // Semantic key was handled
     }
 
-    // Update swapper
-    update_swapper(&sw_win_active, KC_LGUI, KC_TAB, SW_WIN, keycode, record);
+    // Swappers: a trigger holds its modifier, any other key (but Shift...) lets it go
+    if (!process_swappers(keycode, record)) {
+        return false;  // Swapper trigger was handled
+    }
 
     // OS morph: home-row index mod-taps (positions 16/19) use GUI on macOS, Ctrl on Linux
     // On macOS, LGUI_T/RGUI_T hold behavior is correct as-is; on Linux, swap to Ctrl
@@ -378,14 +599,23 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
         }
     }
 
+#if defined(XC_TUNABLES) && defined(XC_ALT_BASE_SYMBOLS)
+    // Alt-symbol pairs switched off at runtime: AS_* are their plain key, Shift as usual
+    if (!is_tunable_flag_on(TUNABLE_FLAG_ALT_BASE_SYMBOLS) && keycode > LIST_START_MARKER(ALT_SYMBOLS) && keycode < LIST_LENGTH(ALT_SYMBOLS)) {
+        static const uint16_t as_plain[] = {KC_QUOT, KC_COMM, KC_DOT, KC_MINS, KC_UNDS};  // ALT_SYMBOLS_LIST order
+        uint16_t plain = as_plain[keycode - LIST_START_MARKER(ALT_SYMBOLS) - 1];
+        if (record->event.pressed) register_code16(plain); else unregister_code16(plain);
+        return false;
+    }
+#endif
+
     switch (keycode) {
         case SEL_LATCH:
             if (record->event.pressed) {
                 if (sel_latch_active) {
                     sel_latch_off();
                 } else {
-                    register_code(KC_LSFT);
-                    sel_latch_active = true;
+                    sel_latch_on();
                 }
             }
             return false;
@@ -462,6 +692,11 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
         // Mod-tap uses basic keycodes; custom shift handled here instead of key overrides
         case RGUI_T(KC_COMM):  // , → ? when shifted
         case RALT_T(KC_DOT):   // . → ! when shifted
+#ifdef XC_TUNABLES
+            if (!is_tunable_flag_on(TUNABLE_FLAG_ALT_BASE_SYMBOLS)) {
+                break;
+            }
+#endif
             if (record->tap.count && record->event.pressed) {
                 uint8_t mods = get_mods() | get_oneshot_mods();
                 if (mods & MOD_MASK_SHIFT) {
@@ -477,20 +712,167 @@ bool process_record_user(uint16_t keycode, keyrecord_t *record) {
     return true;
 }
 
-// Define keys that should be ignored by swapper (allows changing direction)
-bool is_swapper_ignored_key(uint16_t keycode) {
-    switch (keycode) {
-        case SEL_LATCH:
-        case KC_LSFT:
-        case KC_RSFT:
-            return true;
+// Master-side feature state, shared with the slave half (indicators)
+static user_state_t current_user_state(void) {
+    user_state_t state = {
+        .layer      = get_highest_layer(layer_state | default_layer_state),
+        .os_mac     = get_os_platform() == OS_MacOS,
+        .compose    = compose_pending,
+        .sel_latch  = sel_latch_active,
+        .caps_word  = is_caps_word_on(),
+        .layer_lock = is_layer_locked(get_highest_layer(layer_state)),
+        .sw_win     = is_swapper_active(),
+        .context    = get_semkey_context(),
+    };
+    return state;
+}
+
+void keyboard_pre_init_user(void) {
+    boot_profile_mark(BOOT_PHASE_PRE_INIT);
+}
+
+#ifdef RGBLIGHT_ENABLE
+static bool rgb_on_at_boot = false;  // rgblight state loaded from EEPROM by rgblight_init()
+#endif
+
+// Only what the first keystroke needs; the rest waits for keyboard_deferred_init_user()
+void keyboard_post_init_user(void) {
+    split_sync_init();  // the slave must answer the master's first RPC
+#ifdef XC_TUNABLES
+    tunables_init();    // the first key reads the tapping term
+#endif
+#ifdef RGBLIGHT_ENABLE
+    // rgblight_init() has started the saved mode; no animation frames until the deferred init
+    rgb_on_at_boot = rgblight_is_enabled();
+    rgblight_disable_noeeprom();
+#endif
+    boot_profile_mark(BOOT_PHASE_POST_INIT);
+}
+
+// Once USB is configured: EEPROM counters load and RGB startup stay off the boot path
+void keyboard_deferred_init_user(void) {
+#ifdef XC_HEATMAP
+    heatmap_init();
+#endif
+#ifdef RGBLIGHT_ENABLE
+    if (rgb_on_at_boot) {
+        rgblight_enable_noeeprom();
+    }
+#endif
+#ifdef XC_INDICATORS
+    indicators_init();
+#endif
+}
+
+// Run the deferred init, drain batched output (count prefix repeats), expire timed modes,
+// persist counters and tunables, share state with the other half and refresh indicators
+// outside of key processing
+void housekeeping_task_user(void) {
+    boot_profile_task();
+    swapper_task();
+    sl_hold_shift_task();
+#ifdef XC_MACRO_RECORDER
+    macro_recorder_task();
+#endif
+    output_queue_task();
+    num_word_task();
+#ifdef XC_HEATMAP
+    heatmap_task();
+#endif
+#ifdef XC_TUNABLES
+    tunables_task();
+#endif
+    split_sync_update(current_user_state());
+#ifdef XC_INDICATORS
+    indicators_update(get_user_state());
+#endif
+}
+
+#ifdef XC_HEATMAP
+void suspend_power_down_user(void) {
+    heatmap_flush();
+}
+#endif
+
+#ifdef XC_INDICATORS
+// rgblight repaints its own mode on wakeup
+void suspend_wakeup_init_user(void) {
+    indicators_invalidate();
+}
+#endif
+
+#ifdef XC_SL_HOLD_SHIFT
+// Hold-to-shift: ring and pinky columns are slower to lift, they get longer before shifting
+uint16_t get_sl_hold_shift_timeout(uint16_t keycode, keyrecord_t *record) {
+#    ifdef XC_TUNABLES
+    uint16_t timeout = tunables.sl_hold_shift_timeout;
+#    else
+    uint16_t timeout = SL_HOLD_SHIFT_TIMEOUT;
+#    endif
+    uint8_t position = get_key_position(record->event.key);
+    if (position == KEY_POSITION_NONE) {
+        return timeout;
+    }
+    switch (position % 12) {
+        case 0: case 1: case 2:      // left pinky, ring
+        case 9: case 10: case 11:    // right ring, pinky
+            return timeout + SL_HOLD_SHIFT_SLOW_EXTRA;
         default:
-            return false;
+            return timeout;
+    }
+}
+#endif
+
+#ifdef XC_TUNABLES
+// Tap-hold and combo timings from the tunables (build values until edited from the host)
+uint16_t get_tapping_term(uint16_t keycode, keyrecord_t *record) {
+    return tunables.tapping_term;
+}
+
+// Same rule as QMK's default, with the tuned term
+uint16_t get_flow_tap_term(uint16_t keycode, keyrecord_t *record, uint16_t prev_keycode) {
+    return is_flow_tap_key(keycode) && is_flow_tap_key(prev_keycode) ? tunables.flow_tap_term : 0;
+}
+
+uint16_t get_combo_term(uint16_t combo_index, combo_t *combo) {
+    return tunables.combo_term;
+}
+
+#    ifdef XC_WEAK_CORNERS
+// Weak corner combos switched off at runtime: their keys are typed separately
+bool combo_should_trigger(uint16_t combo_index, combo_t *combo, uint16_t keycode, keyrecord_t *record) {
+    if (combo_index >= COMBO_WC_TL && combo_index <= COMBO_WC_BR) {
+        return is_tunable_flag_on(TUNABLE_FLAG_WEAK_CORNERS);
+    }
+    return true;
+}
+#    endif
+#endif
+
+#ifdef XC_MACRO_RECORDER
+// Count prefix: N× then MR_PLY replays the macro N times
+bool count_prefix_user(uint16_t keycode, uint8_t count) {
+    if (keycode != MR_PLY) {
+        return false;
     }
+    macro_recorder_play(((get_mods() | get_oneshot_mods()) & MOD_MASK_SHIFT) ? 1 : 0, count);
+    return true;
+}
+#endif
+
+// Keys that don't end a swap beyond the swappers' own classes (Shift, arrows):
+// the select latch is a Shift too
+bool is_swapper_ignored_key(uint16_t keycode) {
+    return keycode == SEL_LATCH;
 }
 
 // Combo event handler
 void process_combo_event(uint16_t combo_index, bool pressed) {
+#ifdef XC_TELEMETRY
+    if (pressed) {
+        telemetry_combo_event(combo_index);
+    }
+#endif
     switch(combo_index) {
         case COMBO_COMPOSE:
             if (pressed) {
@@ -518,20 +900,63 @@ void process_combo_event(uint16_t combo_index, bool pressed) {
 }
 
 
-// Caps Word: same as QMK default, plus AS_UNDS so SCREAMING_SNAKE survives the
-// custom underscore keycode (default would deactivate on an unknown keycode)
-bool caps_word_press_user(uint16_t keycode) {
+// Word boundaries shared by Caps Word and Case Mode: same as QMK's Caps Word default,
+// plus AS_UNDS so SCREAMING_SNAKE survives the custom underscore keycode (default would
+// deactivate on an unknown keycode), plus Space while a case mode rewrites it
+word_key_t word_key_class(uint16_t keycode) {
     switch (keycode) {
         case KC_A ... KC_Z:
         case KC_MINS:
-            add_weak_mods(MOD_BIT(KC_LSFT));
-            return true;
+            return WORD_KEY_LETTER;
         case KC_1 ... KC_0:
         case KC_BSPC:
         case KC_DEL:
         case KC_UNDS:
 #ifdef XC_ALT_BASE_SYMBOLS
         case AS_UNDS:
+#endif
+            return WORD_KEY_CONTINUE;
+        case KC_SPC:
+            return get_case_mode() != CASE_MODE_OFF ? WORD_KEY_CONTINUE : WORD_KEY_BREAK;
+        default:
+            return WORD_KEY_BREAK;
+    }
+}
+
+// Caps Word: letters (and - → _) are shifted, the rest of the word continues unshifted
+bool caps_word_press_user(uint16_t keycode) {
+    switch (word_key_class(keycode)) {
+        case WORD_KEY_LETTER:
+            add_weak_mods(MOD_BIT(KC_LSFT));
+            return true;
+        case WORD_KEY_CONTINUE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Num Word: digits (top row and numpad), number separators and corrections
+bool num_word_press_user(uint16_t keycode) {
+    switch (keycode) {
+        case KC_1 ... KC_0:
+        case KC_P1 ... KC_P0:
+        case KC_PDOT:
+        case KC_PCMM:
+        case KC_PMNS:
+        case KC_PPLS:
+        case KC_PAST:
+        case KC_PSLS:
+        case KC_PEQL:
+        case KC_COMM:
+        case KC_DOT:
+        case KC_MINS:
+        case KC_BSPC:
+        case KC_DEL:
+#ifdef XC_ALT_BASE_SYMBOLS
+        case AS_COMM:
+        case AS_DOT:
+        case AS_MINS:
 #endif
             return true;
         default:
@@ -539,3 +964,25 @@ bool caps_word_press_user(uint16_t keycode) {
     }
 }
 
+#ifdef XC_HOST_LINK
+// Host Link: the same layout and compose state as SW_LYT/PR_LYT and the compose combo
+uint8_t host_link_get_layout(void) {
+    return get_highest_layer(default_layer_state) == BASE ? 0 : 1;
+}
+
+void host_link_set_layout(uint8_t layout) {
+    default_layer_set(1UL << (layout ? BASE_ALT : BASE));
+}
+
+const char *host_link_layout_name(uint8_t layout) {
+    return layout ? XC_SECONDARY_LAYOUT_NAME : XC_LAYOUT_NAME;
+}
+
+bool host_link_get_compose(void) {
+    return compose_pending;
+}
+
+void host_link_set_compose(bool armed) {
+    compose_pending = armed;
+}
+#endif
@@ -10,12 +10,25 @@ LAYER_LOCK_ENABLE = yes
 CAPS_WORD_ENABLE = yes
 #AUTO_SHIFT_ENABLE = yes
 KEY_OVERRIDE_ENABLE = yes
+# Pointer keys on the MOUSE layer (kinetic curve in config.h)
+MOUSEKEY_ENABLE = yes
 
-# Platform-aware features and swapper
-SRC += features/os_control.c
-SRC += features/swapper.c
-SRC += features/semantic_keys.c
-SRC += features/dead_keys.c
+# Shared features from users/xcambar (switches in users/xcambar/rules.mk)
+USER_NAME := xcambar
+XC_SEMANTIC_KEYS = yes
+XC_DEAD_KEYS = yes
+XC_SWAPPER = yes
+XC_ALT_SYMBOLS_LAYER = yes
+# Hold an SL_* key on SYMBOLS for its shifted partner (timeouts in config.h)
+XC_SL_HOLD_SHIFT ?= yes
+
+SRC += features/output_queue.c
+SRC += features/count_prefix.c
+SRC += features/num_word.c
+SRC += features/case_mode.c
+SRC += features/key_positions.c
+SRC += features/split_sync.c
+SRC += features/boot_profile.c
 
 
 ###################
@@ -27,10 +40,45 @@ XC_LAYOUT ?=gallium_east
 
 # Secondary (alternate base) layout: qwerty, gallium, focal, graphite, or gallium_east
 XC_SECONDARY_LAYOUT ?= qwerty
-XC_WEAK_CORNERS = yes
+XC_WEAK_CORNERS ?= yes
 
-# Alternative symbols for the base layer
+# Alternative symbols for the base layer (shared feature, users/xcambar)
 XC_ALT_BASE_SYMBOLS ?= yes
+
+# Capitalize the first letter of each sentence (. ! ? then Space), Backspace undoes it
+XC_SENTENCE_CASE ?= yes
+
+# Two dynamic macro slots (FAVS Rec/Ply) recording the output sent to the host
+XC_MACRO_RECORDER ?= yes
+
+# Whole-word chords on the base layer (dictionary in feature_word_chords.h)
+XC_WORD_CHORDS ?= no
+
+# Tapping/flow tap/combo terms, hold-to-shift timeout and feature toggles kept in EEPROM,
+# edited live by tools/xc_tune.py (requires XC_HOST_LINK to be edited)
+XC_TUNABLES ?= yes
+
+# Raw HID channel for host tools (app context for semantic keys, see tools/)
+XC_HOST_LINK ?= yes
+
+# Typing statistics (WPM, key intervals, mod-tap holds, combos) read by tools/xc_telemetry.py
+# Requires XC_HOST_LINK
+XC_TELEMETRY ?= yes
+
+# Per-key, per-layer press counters persisted to EEPROM, exported by tools/xc_heatmap.py
+# Requires XC_HOST_LINK
+XC_HEATMAP ?= yes
+
+# Static RGB indicators for layer and modes, redrawn on change only (no-op without RGBLIGHT)
+XC_INDICATORS ?= yes
+
+# Per-key eager-press / deferred-release debounce with latency and chatter instrumentation
+# (off until it has been compared with the stock debounce on a bouncing matrix)
+XC_EAGER_DEBOUNCE ?= no
+
+# Interrupt-assisted scanning: read the pins only after a GPIO edge (direct-pin ChibiOS
+# boards only, e.g. cantor_pro v3)
+XC_EDGE_MATRIX ?= no
 ###################
 # This manipulates the options
 #
@@ -43,7 +91,56 @@ ifeq ($(strip $(XC_WEAK_CORNERS)), yes)
     OPT_DEFS += -DXC_WEAK_CORNERS
 endif
 
-ifeq ($(strip $(XC_ALT_BASE_SYMBOLS)), yes)
-    OPT_DEFS += -DXC_ALT_BASE_SYMBOLS
+ifeq ($(strip $(XC_SENTENCE_CASE)), yes)
+    OPT_DEFS += -DXC_SENTENCE_CASE
+    SRC += features/sentence_case.c
+endif
+
+ifeq ($(strip $(XC_MACRO_RECORDER)), yes)
+    OPT_DEFS += -DXC_MACRO_RECORDER
+    SRC += features/macro_recorder.c
+endif
+
+ifeq ($(strip $(XC_WORD_CHORDS)), yes)
+    OPT_DEFS += -DXC_WORD_CHORDS
+    SRC += features/word_chords.c
+endif
+
+ifeq ($(strip $(XC_HOST_LINK)), yes)
+    RAW_ENABLE = yes
+    OPT_DEFS += -DXC_HOST_LINK
+    SRC += features/host_link.c
+endif
+
+ifeq ($(strip $(XC_TUNABLES)), yes)
+    OPT_DEFS += -DXC_TUNABLES
+    SRC += features/tunables.c
+endif
+
+ifeq ($(strip $(XC_TELEMETRY)), yes)
+    WPM_ENABLE = yes
+    OPT_DEFS += -DXC_TELEMETRY
+    SRC += features/telemetry.c
 endif
 
+ifeq ($(strip $(XC_HEATMAP)), yes)
+    OPT_DEFS += -DXC_HEATMAP
+    SRC += features/heatmap.c
+endif
+
+ifeq ($(strip $(XC_INDICATORS)), yes)
+    OPT_DEFS += -DXC_INDICATORS
+    SRC += features/indicators.c
+endif
+
+ifeq ($(strip $(XC_EAGER_DEBOUNCE)), yes)
+    DEBOUNCE_TYPE = custom
+    OPT_DEFS += -DXC_EAGER_DEBOUNCE
+    SRC += features/eager_debounce.c
+endif
+
+ifeq ($(strip $(XC_EDGE_MATRIX)), yes)
+    CUSTOM_MATRIX = lite
+    OPT_DEFS += -DXC_EDGE_MATRIX
+    SRC += features/edge_matrix.c
+endif
@@ -9,6 +9,10 @@ LAYER_LOCK_ENABLE = yes
 # Enable Auto Shift for automatic capitalization
 AUTO_SHIFT_ENABLE = yes
 
+# Shared features from users/xcambar: all off by default, opt in per feature
+# (e.g. XC_SEMANTIC_KEYS = yes), see users/xcambar/xcambar.h
+USER_NAME := xcambar
+
 # Keep firmware size reasonable
 LTO_ENABLE = yes
 
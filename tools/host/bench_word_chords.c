@@ -0,0 +1,247 @@
+/*
+ * Word chords vs stock combos - matching cost per key event, on the host
+ *
+ * Runs the same typing stream (half plain taps, half dictionary chords) through
+ * process_word_chords() and through a model of QMK's process_combo() matching
+ * loop, for 4, 40 and 400 chords. The combo model keeps only what every event
+ * pays in stock QMK: one pass over all combos, each walking its COMBO_END
+ * terminated key list, with per-combo state in RAM. Buffering, timers and the
+ * combo action itself are left out, so the model is a lower bound for combos.
+ *
+ * Absolute numbers are host numbers; the ratio and how each side scales with
+ * the dictionary size are what carry over to the MCU.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// The engine under test reads the dictionary through these names: point them at
+// tables built at run time
+#define word_chords       (*bench_chords)
+#define word_chords_count (*bench_chords_count)
+#include "word_chords.c"
+#undef word_chords
+#undef word_chords_count
+
+#define MAX_CHORDS 400
+#define SEQUENCES  20000
+#define REPEATS    20
+#define COMBO_END  0
+
+const word_chord_t (*bench_chords)[];
+const uint16_t *bench_chords_count;
+
+static word_chord_t chord_table[MAX_CHORDS];
+static uint16_t     chord_count;
+
+layer_state_t layer_state = 0;
+
+static uint32_t words_sent = 0;
+
+uint8_t get_key_position(keypos_t key) {
+    return key.col;
+}
+void tap_code(uint8_t code) {
+    (void)code;
+}
+void send_string(const char *str) {
+    (void)str;
+    words_sent++;
+}
+
+// Stock combos: per-combo RAM state, keycode lists in flash
+typedef struct {
+    const uint16_t *keys;
+    uint16_t        keycode;
+    bool            disabled;
+    bool            active;
+    uint16_t        state;
+} combo_t;
+
+static combo_t  key_combos[MAX_CHORDS];
+static uint16_t combo_keys[MAX_CHORDS][5];
+static uint16_t combo_len;
+static uint32_t combos_fired = 0;
+
+static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record) {
+    uint8_t key_count = 0;
+    int16_t key_index = -1;
+    for (uint16_t k; (k = combo->keys[key_count]) != COMBO_END; key_count++) {
+        if (k == keycode) {
+            key_index = key_count;
+        }
+    }
+    if (key_index < 0 || combo->disabled) {
+        return false;
+    }
+    uint16_t all = (1 << key_count) - 1;
+    if (record->event.pressed) {
+        combo->state |= 1 << key_index;
+        if (combo->state == all && !combo->active) {
+            combo->active = true;
+            combos_fired++;
+        }
+    } else {
+        combo->state &= ~(1 << key_index);
+        if (combo->state == 0) {
+            combo->active = false;
+        }
+    }
+    return true;
+}
+
+static bool process_combo(uint16_t keycode, keyrecord_t *record) {
+    bool is_combo_key = false;
+    for (uint16_t idx = 0; idx < combo_len; ++idx) {
+        is_combo_key |= process_single_combo(&key_combos[idx], keycode, record);
+    }
+    return is_combo_key;
+}
+
+// Typing stream
+typedef struct {
+    uint8_t  pos;
+    bool     pressed;
+    uint16_t time;
+} event_t;
+
+static event_t *events;
+static uint32_t event_count;
+static uint32_t chords_typed;
+
+static uint32_t rng_state = 0x2545F491;
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static int compare_chords(const void *a, const void *b) {
+    uint64_t ka = ((const word_chord_t *)a)->keys;
+    uint64_t kb = ((const word_chord_t *)b)->keys;
+    return (ka > kb) - (ka < kb);
+}
+
+// 2-4 distinct positions on the 36 alpha keys, unique and sorted like a keymap
+static void build_dictionary(uint16_t n) {
+    chord_count = 0;
+    while (chord_count < n) {
+        uint8_t  size = 2 + rng() % 3;
+        uint64_t keys = 0;
+        while (__builtin_popcountll(keys) < size) {
+            keys |= CHORD_POS(rng() % 36);
+        }
+        bool dup = false;
+        for (uint16_t i = 0; i < chord_count; i++) {
+            dup |= chord_table[i].keys == keys;
+        }
+        if (!dup) {
+            chord_table[chord_count++] = (word_chord_t)WORD_CHORD(keys, "word");
+        }
+    }
+    qsort(chord_table, chord_count, sizeof(word_chord_t), compare_chords);
+
+    combo_len = chord_count;
+    for (uint16_t i = 0; i < chord_count; i++) {
+        uint8_t k = 0;
+        for (uint8_t p = 0; p < 36; p++) {
+            if (chord_table[i].keys & CHORD_POS(p)) {
+                combo_keys[i][k++] = 0x100 + p;
+            }
+        }
+        combo_keys[i][k] = COMBO_END;
+        key_combos[i]    = (combo_t){.keys = combo_keys[i]};
+    }
+}
+
+static void build_stream(void) {
+    event_count  = 0;
+    chords_typed = 0;
+    uint16_t now = 0;
+    for (uint32_t s = 0; s < SEQUENCES; s++) {
+        if (rng() % 2) {
+            uint8_t pos            = rng() % 36;
+            events[event_count++]  = (event_t){pos, true, now};
+            events[event_count++]  = (event_t){pos, false, now + 60};
+            now                   += 150;
+            continue;
+        }
+        uint64_t keys = chord_table[rng() % chord_count].keys;
+        for (uint8_t p = 0; p < 36; p++) {
+            if (keys & CHORD_POS(p)) {
+                events[event_count++]  = (event_t){p, true, now};
+                now                   += 5;
+            }
+        }
+        for (uint8_t p = 0; p < 36; p++) {
+            if (keys & CHORD_POS(p)) {
+                events[event_count++]  = (event_t){p, false, now};
+                now                   += 5;
+            }
+        }
+        now += 150;
+        chords_typed++;
+    }
+}
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static keyrecord_t to_record(const event_t *e) {
+    return (keyrecord_t){.event = {.key = {.col = e->pos, .row = 0}, .pressed = e->pressed, .time = e->time}};
+}
+
+static double run_word_chords(void) {
+    words_sent = 0;
+    double t   = now_ns();
+    for (int r = 0; r < REPEATS; r++) {
+        for (uint32_t i = 0; i < event_count; i++) {
+            keyrecord_t record = to_record(&events[i]);
+            process_word_chords(KC_A + events[i].pos % 26, &record);
+        }
+    }
+    return (now_ns() - t) / ((double)event_count * REPEATS);
+}
+
+static double run_combos(void) {
+    combos_fired = 0;
+    double t     = now_ns();
+    for (int r = 0; r < REPEATS; r++) {
+        for (uint32_t i = 0; i < event_count; i++) {
+            keyrecord_t record = to_record(&events[i]);
+            process_combo(0x100 + events[i].pos, &record);
+        }
+    }
+    return (now_ns() - t) / ((double)event_count * REPEATS);
+}
+
+int main(void) {
+    static const uint16_t sizes[] = {4, 40, 400};
+    const uint16_t       *count   = &chord_count;
+
+    bench_chords       = (const word_chord_t(*)[])chord_table;
+    bench_chords_count = count;
+    events             = malloc(sizeof(event_t) * SEQUENCES * 8);
+
+    printf("%7s %16s %16s %8s\n", "chords", "word chords ns", "combos ns", "ratio");
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        build_dictionary(sizes[i]);
+        build_stream();
+        double wc = run_word_chords();
+        double co = run_combos();
+
+        // Every chord typed must resolve on both sides, plain taps never
+        if (words_sent != chords_typed * REPEATS || combos_fired < chords_typed * REPEATS) {
+            fprintf(stderr, "mismatch: %u chords typed, %u words, %u combos\n", chords_typed * REPEATS, words_sent, combos_fired);
+            return 1;
+        }
+        printf("%7u %16.1f %16.1f %7.1fx\n", sizes[i], wc, co, co / wc);
+    }
+    free(events);
+    return 0;
+}
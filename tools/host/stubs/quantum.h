@@ -0,0 +1,64 @@
+#pragma once
+
+/*
+ * Minimal QMK surface for host builds of keymap features
+ *
+ * Only what the features under test use; the fake clock and the output counters
+ * live in the test or benchmark that includes them.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#define PROGMEM
+#define memcpy_P(dst, src, n) memcpy((dst), (src), (n))
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+typedef uint32_t layer_state_t;
+typedef struct {
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+typedef struct {
+    keypos_t key;
+    bool     pressed;
+    uint16_t time;
+} keyevent_t;
+typedef struct {
+    uint8_t count;
+} tap_t;
+typedef struct {
+    keyevent_t event;
+    tap_t      tap;
+} keyrecord_t;
+
+enum { KC_NO = 0x00, KC_A = 0x04, KC_Z = 0x1D, KC_BSPC = 0x2A };
+
+#define QK_MOD_TAP                    0x2000
+#define QK_MOD_TAP_MAX                0x3FFF
+#define IS_QK_MOD_TAP(kc)             ((kc) >= QK_MOD_TAP && (kc) <= QK_MOD_TAP_MAX)
+#define QK_MOD_TAP_GET_TAP_KEYCODE(kc) ((kc)&0xFF)
+
+#define TIMER_DIFF_16(a, b) ((uint16_t)((a) - (b)))
+
+// Matrix geometry comes from the build flags, like a keyboard's config.h
+#ifdef MATRIX_COLS
+typedef uint8_t matrix_row_t;  // MATRIX_COLS <= 8
+#    define MATRIX_ROW_SHIFTER ((matrix_row_t)1)
+#endif
+
+extern layer_state_t layer_state;
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+
+void eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length);
+void eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length);
+
+bool is_keyboard_master(void);
+void tap_code(uint8_t code);
+void send_string(const char *str);
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+typedef void (*slave_callback_t)(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data);
+
+void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
+bool transaction_rpc_send(int8_t transaction_id, uint8_t initiator2target_buflen, const void *initiator2target_buf);
@@ -0,0 +1,143 @@
+/*
+ * Eager debounce - press and release edges from raw contact waveforms, on the host
+ *
+ * One scan per millisecond on a fake clock. A waveform is a string, one character
+ * per scan: '#' for closed contacts, '_' for open. Only key (0, 0) moves; its
+ * cooked edges are collected with their times and checked against what the
+ * filter promises: one press on the first closed scan, one release DEBOUNCE ms
+ * after the contacts last opened (or after the press lockout, if they opened
+ * inside it), and the instrumentation reporting the same delays.
+ */
+
+#include <stdio.h>
+#include "debounce.h"
+#include "eager_debounce.h"
+
+static uint16_t clock_ms = 1000;  // away from 0: release times start there
+
+uint16_t timer_read(void) {
+    return clock_ms;
+}
+uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)(clock_ms - last);
+}
+
+static matrix_row_t raw[MATRIX_ROWS];
+static matrix_row_t cooked[MATRIX_ROWS];
+
+// Cooked edges of key (0, 0), relative to the start of the waveform
+static unsigned presses, releases;
+static int      press_at, release_at;
+
+static int failures = 0;
+
+#define CHECK(cond)                                                \
+    do {                                                           \
+        if (!(cond)) {                                             \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                            \
+        }                                                          \
+    } while (0)
+
+static void scan(bool down, int t) {
+    matrix_row_t before  = cooked[0];
+    matrix_row_t new_row = down ? 1 : 0;
+    bool         changed = new_row != raw[0];
+    raw[0]               = new_row;
+    debounce(raw, cooked, MATRIX_ROWS, changed);
+    if (!(before & 1) && (cooked[0] & 1)) {
+        presses++;
+        press_at = t;
+    }
+    if ((before & 1) && !(cooked[0] & 1)) {
+        releases++;
+        release_at = t;
+    }
+    clock_ms++;
+}
+
+// Plays the waveform then keeps the contacts open until everything settled
+static void play(const char *wave) {
+    presses = releases = 0;
+    press_at = release_at = -1;
+    debounce_stats_reset();
+    int t = 0;
+    for (; wave[t]; t++) {
+        scan(wave[t] == '#', t);
+    }
+    for (int idle = 0; idle < 10 * DEBOUNCE; idle++, t++) {
+        scan(false, t);
+    }
+    clock_ms += 100;  // the next waveform is not chatter
+}
+
+static void test_clean_tap(void) {
+    puts("clean tap");
+    play("##########################################________");
+    CHECK(presses == 1 && press_at == 0);
+    CHECK(releases == 1 && release_at == 42 + DEBOUNCE);
+    CHECK(get_debounce_stats()->release_latency_max == DEBOUNCE);
+    CHECK(get_debounce_stats()->bounces == 0);
+}
+
+static void test_bouncy_press(void) {
+    puts("bouncy press");
+    play("#_#__#####################################________");
+    CHECK(presses == 1 && press_at == 0);  // eager: the first closed scan
+    CHECK(releases == 1 && release_at == 42 + DEBOUNCE);
+    CHECK(get_debounce_stats()->bounces > 0);
+    CHECK(get_debounce_stats()->press_count == 1);
+}
+
+static void test_bouncy_release(void) {
+    puts("bouncy release");
+    play("##########################################_#_##_#____");
+    CHECK(presses == 1 && press_at == 0);
+    CHECK(releases == 1 && release_at == 49 + DEBOUNCE);  // DEBOUNCE after the last opening
+    CHECK(get_debounce_stats()->release_latency_max == DEBOUNCE);
+    CHECK(get_debounce_stats()->release_count == 1);
+}
+
+static void test_release_chatter(void) {
+    puts("release chatter");
+    // Gaps shorter than DEBOUNCE: one release, after the contacts finally stay open
+    play("##############################_#__#___#____#______");
+    CHECK(presses == 1);
+    CHECK(releases == 1 && release_at == 44 + DEBOUNCE);
+    CHECK(get_debounce_stats()->chatter[0][0] == 0);
+}
+
+static void test_open_during_lockout(void) {
+    puts("opened during the press lockout");
+    // Contacts last open at 3: the release waits for the lockout, then DEBOUNCE more
+    play("##_#________");
+    CHECK(presses == 1 && press_at == 0);
+    CHECK(releases == 1 && release_at == 2 * DEBOUNCE);
+    CHECK(get_debounce_stats()->release_latency_max == 2 * DEBOUNCE - 4);  // from the opening, not the lockout end
+}
+
+static void test_chatter_through(void) {
+    puts("chatter let through");
+    // Open longer than DEBOUNCE, then closed again: two presses, the second counted as chatter
+    play("##############################__________####################________");
+    CHECK(presses == 2 && releases == 2);
+    CHECK(get_debounce_stats()->chatter[0][0] == 1);
+}
+
+int main(void) {
+    debounce_init(MATRIX_ROWS);
+
+    test_clean_tap();
+    test_bouncy_press();
+    test_bouncy_release();
+    test_release_chatter();
+    test_open_during_lockout();
+    test_chatter_through();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    puts("ok");
+    return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * Split sync - change detection, heartbeat and retry, on the host
+ *
+ * split_sync.c is built twice: this file is the master half, and the slave half
+ * is a second object with its public names prefixed (see the Makefile), so each
+ * half keeps its own static state. transaction_rpc_send() hands the master's
+ * payload to the handler the slave registered, unless the test drops the link.
+ */
+
+#include <stdio.h>
+#include "split_sync.h"
+#include "transactions.h"
+
+// The slave half, built from the same source
+void         slave_split_sync_init(void);
+void         slave_split_sync_update(user_state_t state);
+user_state_t slave_get_user_state(void);
+
+static uint32_t clock_ms      = 0;
+static bool     master        = true;
+static bool     link_up       = true;
+static unsigned rpc_attempts  = 0;
+static unsigned rpc_delivered = 0;
+
+static slave_callback_t slave_handler = NULL;
+
+uint16_t timer_read(void) {
+    return clock_ms;
+}
+uint32_t timer_read32(void) {
+    return clock_ms;
+}
+uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)(clock_ms - last);
+}
+uint32_t timer_elapsed32(uint32_t last) {
+    return clock_ms - last;
+}
+
+bool is_keyboard_master(void) {
+    return master;
+}
+bool slave_is_keyboard_master(void) {
+    return false;
+}
+
+void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback) {
+    // The master registers too (both halves run the same init); keep the slave's
+}
+void slave_transaction_register_rpc(int8_t transaction_id, slave_callback_t callback) {
+    slave_handler = callback;
+}
+bool transaction_rpc_send(int8_t transaction_id, uint8_t initiator2target_buflen, const void *initiator2target_buf) {
+    rpc_attempts++;
+    if (!link_up || slave_handler == NULL) {
+        return false;
+    }
+    slave_handler(initiator2target_buflen, initiator2target_buf, 0, NULL);
+    rpc_delivered++;
+    return true;
+}
+
+static int failures = 0;
+
+#define CHECK(cond)                                                \
+    do {                                                           \
+        if (!(cond)) {                                             \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                            \
+        }                                                          \
+    } while (0)
+
+// One housekeeping pass per millisecond, like a fast scan loop
+static void run(user_state_t state, uint32_t ms) {
+    for (uint32_t i = 0; i < ms; i++) {
+        split_sync_update(state);
+        clock_ms++;
+    }
+}
+
+static user_state_t state_with_layer(uint8_t layer) {
+    user_state_t state = {.raw = 0};
+    state.layer        = layer;
+    return state;
+}
+
+static void test_change_detection(void) {
+    puts("change detection");
+    rpc_attempts = rpc_delivered = 0;
+
+    run(state_with_layer(1), 500);
+    CHECK(rpc_delivered == 1);  // first pass only
+    CHECK(slave_get_user_state().raw == state_with_layer(1).raw);
+
+    run(state_with_layer(2), 1);
+    CHECK(rpc_delivered == 2);  // a change goes out on the same pass
+    CHECK(slave_get_user_state().raw == state_with_layer(2).raw);
+}
+
+static void test_heartbeat(void) {
+    puts("heartbeat");
+    run(state_with_layer(3), 1);
+    rpc_attempts = rpc_delivered = 0;
+
+    run(state_with_layer(3), SPLIT_SYNC_HEARTBEAT - 1);
+    CHECK(rpc_delivered == 0);
+    run(state_with_layer(3), 1);
+    CHECK(rpc_delivered == 1);  // unchanged state resent after SPLIT_SYNC_HEARTBEAT
+    run(state_with_layer(3), 3 * SPLIT_SYNC_HEARTBEAT);
+    CHECK(rpc_delivered == 4);
+}
+
+static void test_retry(void) {
+    puts("retry");
+    run(state_with_layer(4), 1);
+    rpc_attempts = rpc_delivered = 0;
+
+    link_up = false;
+    run(state_with_layer(5), 10);
+    CHECK(rpc_attempts == 10);  // every pass retries while the link is down
+    CHECK(rpc_delivered == 0);
+    CHECK(slave_get_user_state().raw == state_with_layer(4).raw);
+
+    link_up = true;
+    run(state_with_layer(5), 10);
+    CHECK(rpc_attempts == 11);  // delivered on the next pass, then quiet
+    CHECK(rpc_delivered == 1);
+    CHECK(slave_get_user_state().raw == state_with_layer(5).raw);
+}
+
+static void test_savings(void) {
+    puts("savings");
+    run(state_with_layer(6), 2500);  // the last full window saw only heartbeats
+    uint16_t sent = split_sync_bytes_sent();
+    CHECK(sent >= sizeof(user_state_t) && sent <= 2 * sizeof(user_state_t));
+    CHECK(split_sync_bytes_saved() + sent == 1000 * sizeof(user_state_t));
+}
+
+static void test_slave_ignores_updates(void) {
+    puts("slave ignores updates");
+    run(state_with_layer(1), 1);
+    unsigned before = rpc_attempts;
+
+    master = false;
+    split_sync_update(state_with_layer(2));
+    master = true;
+    CHECK(rpc_attempts == before);
+    CHECK(get_user_state().raw == state_with_layer(1).raw);
+
+    slave_split_sync_update(state_with_layer(2));  // not the master: no effect
+    CHECK(slave_get_user_state().raw == state_with_layer(1).raw);
+}
+
+int main(void) {
+    split_sync_init();
+    slave_split_sync_init();
+
+    test_change_detection();
+    test_heartbeat();
+    test_retry();
+    test_savings();
+    test_slave_ignores_updates();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    puts("ok");
+    return 0;
+}
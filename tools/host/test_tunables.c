@@ -0,0 +1,190 @@
+/*
+ * Tunables - EEPROM ring and saves copied to the other half, on the host
+ *
+ * tunables.c is built twice like split_sync.c (see the Makefile): this file drives
+ * the master, and the slave copy has its public names and its EEPROM prefixed. Each
+ * half's user datablock is a byte array; the fake RPC hands the master's payload to
+ * the slave's handler unless the test drops the link.
+ */
+
+#include <stdio.h>
+#include "tunables.h"
+#include "transactions.h"
+
+// The slave half, built from the same source
+extern tunables_t slave_tunables;
+void              slave_tunables_init(void);
+void              slave_tunables_task(void);
+
+static uint8_t  master_eeprom[EECONFIG_USER_DATA_SIZE];
+static uint8_t  slave_eeprom[EECONFIG_USER_DATA_SIZE];
+static unsigned master_writes = 0;
+static unsigned slave_writes  = 0;
+
+static uint32_t clock_ms      = 0;
+static bool     link_up       = true;
+static unsigned rpc_attempts  = 0;
+static unsigned rpc_delivered = 0;
+
+static slave_callback_t slave_handler = NULL;
+
+uint16_t timer_read(void) {
+    return clock_ms;
+}
+uint32_t timer_read32(void) {
+    return clock_ms;
+}
+uint16_t timer_elapsed(uint16_t last) {
+    return (uint16_t)(clock_ms - last);
+}
+uint32_t timer_elapsed32(uint32_t last) {
+    return clock_ms - last;
+}
+
+void eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length) {
+    memcpy(data, master_eeprom + offset, length);
+}
+void eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length) {
+    memcpy(master_eeprom + offset, data, length);
+    master_writes++;
+}
+void slave_eeconfig_read_user_datablock(void *data, uint32_t offset, uint32_t length) {
+    memcpy(data, slave_eeprom + offset, length);
+}
+void slave_eeconfig_update_user_datablock(const void *data, uint32_t offset, uint32_t length) {
+    memcpy(slave_eeprom + offset, data, length);
+    slave_writes++;
+}
+
+void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback) {
+    // The master registers too (both halves run the same init); keep the slave's
+}
+void slave_transaction_register_rpc(int8_t transaction_id, slave_callback_t callback) {
+    slave_handler = callback;
+}
+bool transaction_rpc_send(int8_t transaction_id, uint8_t initiator2target_buflen, const void *initiator2target_buf) {
+    rpc_attempts++;
+    if (!link_up || slave_handler == NULL) {
+        return false;
+    }
+    slave_handler(initiator2target_buflen, initiator2target_buf, 0, NULL);
+    rpc_delivered++;
+    return true;
+}
+
+static int failures = 0;
+
+#define CHECK(cond)                                                \
+    do {                                                           \
+        if (!(cond)) {                                             \
+            printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                            \
+        }                                                          \
+    } while (0)
+
+// One housekeeping pass per millisecond on each half
+static void run(uint32_t ms) {
+    for (uint32_t i = 0; i < ms; i++) {
+        tunables_task();
+        slave_tunables_task();
+        clock_ms++;
+    }
+}
+
+// A power cycle of both halves: RAM from EEPROM
+static void reboot(void) {
+    tunables_init();
+    slave_tunables_init();
+}
+
+static void test_defaults(void) {
+    puts("defaults");
+    reboot();
+    CHECK(tunables.tapping_term == TAPPING_TERM);
+    CHECK(slave_tunables.tapping_term == TAPPING_TERM);
+}
+
+static void test_save_reaches_both_halves(void) {
+    puts("save reaches both halves");
+    CHECK(tunables_set(TUNABLE_TAPPING_TERM, 220));
+    tunables_save();
+    CHECK(master_writes == 1);
+    CHECK(slave_writes == 0);  // written from the slave's housekeeping, not the handler
+    run(1);
+    CHECK(slave_writes == 1);
+
+    reboot();
+    CHECK(tunables.tapping_term == 220);
+    CHECK(slave_tunables.tapping_term == 220);
+}
+
+static void test_retry_until_connected(void) {
+    puts("retry until connected");
+    rpc_attempts = 0;
+    link_up      = false;
+    CHECK(tunables_set(TUNABLE_COMBO_TERM, 45));
+    tunables_save();
+    CHECK(rpc_attempts == 1);
+
+    run(TUNABLES_SYNC_RETRY - 1);
+    CHECK(rpc_attempts == 1);  // rate-limited
+    run(2 * TUNABLES_SYNC_RETRY);
+    CHECK(rpc_attempts == 3);
+    CHECK(slave_tunables.combo_term != 45);
+
+    CHECK(tunables_set(TUNABLE_COMBO_TERM, 60));  // edited, not saved: the save is what gets sent
+    link_up = true;
+    run(TUNABLES_SYNC_RETRY);
+    CHECK(rpc_attempts == 4);
+    CHECK(slave_tunables.combo_term == 45);
+    run(10 * TUNABLES_SYNC_RETRY);
+    CHECK(rpc_attempts == 4);  // delivered: no more sends
+
+    reboot();
+    CHECK(tunables.combo_term == 45);
+    CHECK(slave_tunables.combo_term == 45);
+}
+
+static void test_ring_keeps_newest(void) {
+    puts("ring keeps the newest record");
+    for (uint16_t term = 300; term < 300 + 3 * TUNABLES_SLOTS; term++) {
+        tunables_set(TUNABLE_TAPPING_TERM, term);
+        tunables_save();
+        run(1);
+    }
+    reboot();
+    CHECK(tunables.tapping_term == 300 + 3 * TUNABLES_SLOTS - 1);
+    CHECK(slave_tunables.tapping_term == 300 + 3 * TUNABLES_SLOTS - 1);
+}
+
+static void test_out_of_bounds_ignored(void) {
+    puts("out of bounds values ignored");
+    uint16_t before = slave_tunables.flow_tap_term;
+    uint16_t values[TUNABLE_COUNT];
+    memcpy(values, &tunables, sizeof(values));
+    values[TUNABLE_FLOW_TAP_TERM] = 60000;
+    slave_handler(sizeof(values), values, 0, NULL);
+    CHECK(slave_tunables.flow_tap_term == before);
+
+    uint8_t short_payload[2] = {0};
+    unsigned writes          = slave_writes;
+    run(1);  // the valid part of the payload above is saved
+    slave_handler(sizeof(short_payload), short_payload, 0, NULL);
+    run(1);
+    CHECK(slave_writes == writes + 1);  // a malformed payload is not
+}
+
+int main(void) {
+    test_defaults();
+    test_save_reaches_both_halves();
+    test_retry_until_connected();
+    test_ring_keeps_newest();
+    test_out_of_bounds_ignored();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    puts("ok");
+    return 0;
+}
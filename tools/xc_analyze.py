@@ -0,0 +1,499 @@
+#!/usr/bin/env python3
+"""Score the base layouts and the SYMBOLS layer of the crafted keymap on a corpus.
+
+Reads the layout headers (layouts/*.h) and the BASE and SYMBOLS tables of keymaps[]
+in keymap.c, with the feature switches of rules.mk, and works out how each character
+is typed: plain, shifted, on SYMBOLS (tapped, held for its pair, or shifted), as a
+weak corner combo or through Compose. The corpus is then scored per layout:
+keystrokes per character, layer switches, combos, Compose, same-finger bigrams,
+scissors and hand alternation.
+
+Files are cut into chunks counted on every core. Only character bigrams are
+counted, so every layout is scored from the same pass over the corpus.
+
+    tools/xc_analyze.py notes/ ~/src/project/           # every layout, files under both
+    tools/xc_analyze.py --layout gallium_east,graphite corpus.txt
+    tools/xc_analyze.py --symbols ~/src/project/        # SYMBOLS use per key, for XC_LAYOUT
+    tools/xc_analyze.py --set XC_WEAK_CORNERS=no corpus.txt
+"""
+
+import argparse
+import os
+import re
+import sys
+import time
+from collections import Counter, namedtuple
+from multiprocessing import Pool
+from pathlib import Path
+from string import ascii_uppercase
+
+USERSPACE = Path(__file__).resolve().parent.parent
+KEYMAP_DIR = USERSPACE / "keyboards" / "6x3_3" / "keymaps" / "crafted"
+
+CHUNK_SIZE = 16 << 20  # bytes counted per task
+IGNORED = {"\r"}       # CRLF counts as Enter
+
+# Switches the tables depend on; defaults come from rules.mk
+FLAGS = ["XC_LAYOUT", "XC_WEAK_CORNERS", "XC_ALT_BASE_SYMBOLS", "XC_SL_HOLD_SHIFT"]
+RULE_RE = re.compile(r"^(XC_\w+)\s*\??=\s*(\w+)\s*$", re.MULTILINE)
+
+# Key positions 0-41 in LAYOUT_split_3x6_3 order: 3 rows of 12, then the 6 thumbs
+THUMB = 4
+COLUMN_FINGERS = [0, 0, 1, 2, 3, 3, 3, 3, 2, 1, 0, 0]  # pinky, ring, middle, index
+FINGER_NAMES = ["pinky", "ring", "middle", "index", "thumb"]
+
+# Basic keycodes on a US host layout: (unshifted, shifted)
+BASIC = {f"KC_{c}": (c.lower(), c) for c in ascii_uppercase}
+BASIC.update({f"KC_{d}": (d, s) for d, s in zip("1234567890", "!@#$%^&*()")})
+BASIC.update({
+    "KC_MINS": ("-", "_"), "KC_EQL": ("=", "+"), "KC_LBRC": ("[", "{"), "KC_RBRC": ("]", "}"),
+    "KC_BSLS": ("\\", "|"), "KC_SCLN": (";", ":"), "KC_QUOT": ("'", '"'), "KC_GRV": ("`", "~"),
+    "KC_COMM": (",", "<"), "KC_DOT": (".", ">"), "KC_SLSH": ("/", "?"),
+    "KC_SPC": (" ", None), "KC_ENT": ("\n", None), "KC_TAB": ("\t", None),
+})
+# Shifted aliases (LSFT(KC_...)): the same character with or without Shift
+SHIFTED = {
+    "KC_EXLM": "!", "KC_AT": "@", "KC_HASH": "#", "KC_DLR": "$", "KC_PERC": "%", "KC_CIRC": "^",
+    "KC_AMPR": "&", "KC_ASTR": "*", "KC_LPRN": "(", "KC_RPRN": ")", "KC_UNDS": "_", "KC_PLUS": "+",
+    "KC_LCBR": "{", "KC_RCBR": "}", "KC_PIPE": "|", "KC_COLN": ":", "KC_DQUO": '"', "KC_TILD": "~",
+    "KC_LT": "<", "KC_GT": ">", "KC_QUES": "?",
+}
+
+# What the Compose keys of keymap.c produce (dead key + vowel, or a semantic key)
+DEAD_KEY_CHARS = {
+    "DK_ACUTE": dict(zip("aeiouy", "áéíóúý")),
+    "DK_GRAVE": dict(zip("aeiou", "àèìòù")),
+    "DK_DIAE": dict(zip("aeiouy", "äëïöüÿ")),
+    "DK_CIRC": dict(zip("aeiou", "âêîôû")),
+}
+SEMKEY_CHARS = {"SK_CEDIL": "ç", "SK_NTILDE": "ñ", "SK_EURO": "€"}
+
+# How a character is typed: chords pressed in turn (one position each, or the keys of a
+# combo), while SYMBOLS and/or Shift are held. kind: key, hold (SL_* pair), corner, compose
+Plan = namedtuple("Plan", "presses symbols shift kind")
+
+METRICS = [
+    ("keystrokes/char", "keystrokes"),
+    ("layer switches /1k", "switches"),
+    ("shift presses /1k", "shifts"),
+    ("hold-to-shift /1k", "holds"),
+    ("corner combos /1k", "corners"),
+    ("compose /1k", "compose"),
+    ("same-finger bigrams %", "sfb"),
+    ("scissors %", "scissors"),
+    ("hand alternation %", "alternation"),
+]
+
+
+class AnalyzeError(Exception):
+    pass
+
+
+def hand(position):
+    return "L" if (position < 36 and position % 12 < 6) or 36 <= position < 39 else "R"
+
+
+def finger(position):
+    return THUMB if position >= 36 else COLUMN_FINGERS[position % 12]
+
+
+# --- Reading the tables -------------------------------------------------------------
+
+def strip_comments(text):
+    return re.sub(r"//[^\n]*|/\*.*?\*/", "", text, flags=re.S)
+
+
+def condition(expression, defined):
+    # #if with defined(), !, && and ||; any other identifier is 0, as in cpp
+    expression = re.sub(r"defined\s*\(?\s*(\w+)\s*\)?", lambda m: " 1 " if m.group(1) in defined else " 0 ", expression)
+    expression = expression.replace("&&", " and ").replace("||", " or ")
+    expression = re.sub(r"!(?!=)", " not ", expression)
+    expression = re.sub(r"\b[A-Za-z_]\w*\b", lambda m: m.group(0) if m.group(0) in ("and", "or", "not") else "0", expression)
+    return bool(eval(expression, {"__builtins__": {}}))
+
+
+def object_macros(path, defined):
+    """The object-like #defines of a file under the given switches (a tiny cpp: no #include)."""
+    macros = {}
+    stack = []  # (active, a branch was taken) per open #if
+    text = strip_comments(path.read_text()).replace("\\\n", " ")
+    for line in text.splitlines():
+        m = re.match(r"\s*#\s*(\w+)\s*(.*)", line)
+        if not m:
+            continue
+        directive, rest = m.group(1), m.group(2).strip()
+        active = all(level[0] for level in stack)
+        if directive in ("ifdef", "ifndef", "if"):
+            if directive == "if":
+                taken = active and condition(rest, defined)
+            else:
+                taken = active and ((rest in defined or rest in macros) == (directive == "ifdef"))
+            stack.append([taken, taken])
+        elif directive == "elif":
+            outer = all(level[0] for level in stack[:-1])
+            stack[-1][0] = outer and not stack[-1][1] and condition(rest, defined)
+            stack[-1][1] |= stack[-1][0]
+        elif directive == "else":
+            outer = all(level[0] for level in stack[:-1])
+            stack[-1][0] = outer and not stack[-1][1]
+        elif directive == "endif":
+            stack.pop()
+        elif active and directive == "define":
+            d = re.match(r"(\w+)(\(?)\s*(.*)", rest)
+            if not d.group(2):  # function-like macros are left alone
+                macros[d.group(1)] = d.group(3).strip()
+        elif active and directive == "undef":
+            macros.pop(rest, None)
+    return macros
+
+
+def split_arguments(text):
+    arguments, depth, current = [], 0, ""
+    for c in text:
+        if c == "," and depth == 0:
+            arguments.append(current.strip())
+            current = ""
+            continue
+        depth += (c == "(") - (c == ")")
+        current += c
+    if current.strip():
+        arguments.append(current.strip())
+    return arguments
+
+
+def layer_table(source, layer):
+    start = re.search(rf"\[{layer}\]\s*=\s*LAYOUT_split_3x6_3\(", source)
+    if not start:
+        raise AnalyzeError(f"keymap.c: no [{layer}] layer in keymaps[]")
+    depth, i = 1, start.end()
+    while depth:
+        depth += (source[i] == "(") - (source[i] == ")")
+        i += 1
+    keys = split_arguments(strip_comments(source[start.end():i - 1]))
+    if len(keys) != 42:
+        raise AnalyzeError(f"keymap.c: [{layer}] has {len(keys)} keys, expected 42")
+    return keys
+
+
+def resolve(token, macros, weak_corners):
+    for _ in range(10):
+        token = token.strip()
+        mod_tap = re.fullmatch(r"\w+_T\((.+)\)", token)
+        if mod_tap:
+            token = mod_tap.group(1).strip()
+        # The tap of the _32_/_33_ mod-taps is morphed into the alt symbol by keymap.c
+        token = re.sub(r"^(_\d\d_)KC$", r"\1", token)
+        corner = re.fullmatch(r"WC_CORNER\((.+)\)", token)
+        if corner:
+            return "KC_NO" if weak_corners else resolve(corner.group(1), macros, weak_corners)
+        if token not in macros:
+            return token
+        token = macros[token]
+    raise AnalyzeError(f"{token}: macro loop")
+
+
+class Keymap:
+    """The BASE and SYMBOLS tables and the combos, for one base layout."""
+
+    def __init__(self, layout, flags):
+        defined = {name for name, value in flags.items() if value == "yes"}
+        layout_file = KEYMAP_DIR / "layouts" / f"{layout}.h"
+        if not layout_file.exists():
+            raise AnalyzeError(f"{layout_file} not found")
+        source = (KEYMAP_DIR / "keymap.c").read_text()
+        macros = object_macros(KEYMAP_DIR / "keymap.c", defined)
+        macros.update(object_macros(layout_file, defined))
+        weak = "XC_WEAK_CORNERS" in defined
+
+        self.base = [resolve(k, macros, weak) for k in layer_table(source, "BASE")]
+        self.symbols = [resolve(k, macros, weak) for k in layer_table(source, "SYMBOLS")]
+        self.hold_shift = "XC_SL_HOLD_SHIFT" in defined
+
+        # Shift pairs: alt base symbols (key overrides) and the SYMBOLS SL_* pairs
+        self.pairs = {}
+        for trigger, plain, shifted in re.findall(r"ALT_SYMBOL_OVERRIDE\((\w+),\s*(\w+),\s*(\w+)\)", strip_comments(source)):
+            self.pairs[trigger] = (self.char(plain), self.char(shifted))
+        for trigger, plain, shifted in re.findall(r"X\((SL_\w+),\s*(\w+),\s*(\w+)\)", source):
+            self.pairs[trigger] = (self.char(plain), self.char(shifted))
+
+        self.shift_key = self.base.index("KC_LSFT")
+        self.symbols_key = self.base.index("MO(SYMBOLS)")
+
+        # Weak corner combos, in the order of WC_OUT_01/10/29/30
+        self.corners = []
+        if weak:
+            combos = re.findall(r"weak_corner_\w+_combo\[\]\s*=\s*\{(.*?)COMBO_END", (KEYMAP_DIR / "feature_weak_corners.h").read_text())
+            for combo, corner in zip(combos, ["01", "10", "29", "30"]):
+                positions = tuple(int(n) for n in re.findall(r"_(\d\d)_", combo))
+                self.corners.append((positions, resolve(f"WC_OUT_{corner}", macros, False)))
+
+        # Compose: the thumb combo, then a letter picking a dead key or a character
+        combo = re.search(r"compose_combo\[\]\s*=\s*\{(.*?),\s*COMBO_END", source).group(1)
+        self.compose_combo = tuple(self.base.index(k.strip()) for k in combo.split(","))
+        self.compose = re.findall(r"case (KC_\w+):\s*compose_pending = false;\s*tap_\w+_code\((\w+)\)", source)
+
+    def char(self, keycode, shifted=False):
+        if keycode in self.__dict__.get("pairs", {}):
+            return self.pairs[keycode][shifted]
+        if keycode in SHIFTED:
+            return SHIFTED[keycode]
+        if keycode in BASIC:
+            return BASIC[keycode][shifted]
+        return None
+
+    def plans(self):
+        """The cheapest way to type each character (fewest key presses, then this order)."""
+        found = {}
+
+        def offer(char, plan):
+            cost = sum(len(chord) for chord in plan.presses) + plan.symbols + plan.shift
+            if char and (char not in found or cost < found[char][0]):
+                found[char] = (cost, plan)
+
+        for position, keycode in enumerate(self.base):
+            offer(self.char(keycode), Plan(((position,),), False, False, "key"))
+        for position, keycode in enumerate(self.symbols):
+            offer(self.char(keycode), Plan(((position,),), True, False, "key"))
+            if self.hold_shift and keycode.startswith("SL_"):
+                offer(self.char(keycode, True), Plan(((position,),), True, False, "hold"))
+        for position, keycode in enumerate(self.base):
+            offer(self.char(keycode, True), Plan(((position,),), False, True, "key"))
+        for positions, keycode in self.corners:
+            offer(self.char(keycode), Plan((positions,), False, False, "corner"))
+            offer(self.char(keycode, True), Plan((positions,), False, True, "corner"))
+        for position, keycode in enumerate(self.symbols):
+            offer(self.char(keycode, True), Plan(((position,),), True, True, "key"))
+
+        # Compose picks letters by keycode: where they are on BASE, unshifted
+        position_of = {char: plan.presses[0][0] for char, (cost, plan) in found.items()
+                       if char.isalpha() and plan.kind == "key" and not plan.symbols and not plan.shift}
+        for letter_keycode, action in self.compose:
+            letter = self.char(letter_keycode)
+            if letter not in position_of:
+                continue
+            picked = (self.compose_combo, (position_of[letter],))
+            if action in SEMKEY_CHARS:
+                offer(SEMKEY_CHARS[action], Plan(picked, False, False, "compose"))
+            for vowel, accented in DEAD_KEY_CHARS.get(action, {}).items():
+                if vowel in position_of:
+                    presses = picked + ((position_of[vowel],),)
+                    offer(accented, Plan(presses, False, False, "compose"))
+                    offer(accented.upper(), Plan(presses, False, True, "compose"))
+        return {char: plan for char, (cost, plan) in found.items()}
+
+
+# --- Counting the corpus ------------------------------------------------------------
+
+def count_chunk(job):
+    path, start, end = job
+    with open(path, "rb") as f:
+        f.seek(start)
+        data = f.read(end - start + 3)
+    # Cut on byte offsets: move both ends past UTF-8 continuation bytes
+    head = 0
+    if start:
+        while head < len(data) and data[head] & 0xC0 == 0x80:
+            head += 1
+    tail = end - start
+    while tail < len(data) and data[tail] & 0xC0 == 0x80:
+        tail += 1
+    text = data[head:tail].decode("utf-8", errors="replace")
+    return Counter(zip(text, text[1:])), text[:1], text[-1:]
+
+
+def corpus_files(paths):
+    for path in paths:
+        path = Path(path)
+        if path.is_dir():
+            for root, dirs, files in os.walk(path):
+                dirs[:] = sorted(d for d in dirs if not d.startswith("."))
+                yield from (Path(root) / name for name in sorted(files))
+        elif path.exists():
+            yield path
+        else:
+            raise AnalyzeError(f"{path} not found")
+
+
+def is_text(path):
+    with open(path, "rb") as f:
+        return b"\0" not in f.read(4096)
+
+
+def count_corpus(paths, jobs):
+    """Character unigrams and bigrams of every file, in one pass split across processes."""
+    tasks, file_ends = [], []
+    for path in corpus_files(paths):
+        size = path.stat().st_size
+        if size == 0 or not is_text(path):
+            continue
+        tasks += [(str(path), start, min(start + CHUNK_SIZE, size)) for start in range(0, size, CHUNK_SIZE)]
+        file_ends.append(len(tasks) - 1)
+    if not tasks:
+        raise AnalyzeError("no text in the corpus")
+
+    bigrams = Counter()
+    with Pool(jobs) as pool:
+        results = pool.map(count_chunk, tasks, chunksize=1)
+    for i, (counts, first, last) in enumerate(results):
+        bigrams.update(counts)
+        if i not in file_ends and results[i + 1][1] and last:
+            bigrams[(last, results[i + 1][1])] += 1  # across the cut
+
+    unigrams = Counter()
+    for (a, _), n in bigrams.items():
+        unigrams[a] += n
+    for i in file_ends:
+        if results[i][2]:
+            unigrams[results[i][2]] += 1  # the last character has no bigram
+    return unigrams, bigrams, len(file_ends)
+
+
+# --- Scoring --------------------------------------------------------------------------
+
+def strokes(plan):
+    """The finger chords of a plan (thumbs left out: they hold Shift, layers, Space)."""
+    chords = [tuple(p for p in chord if finger(p) != THUMB) for chord in plan.presses]
+    return [chord for chord in chords if chord]
+
+
+def pair_kind(first, second):
+    hands = {hand(p) for p in first}, {hand(p) for p in second}
+    if len(hands[0] | hands[1]) == 2 and not hands[0] & hands[1]:
+        return "alternation"
+    for a in first:
+        for b in second:
+            if hand(a) != hand(b):
+                continue
+            if finger(a) == finger(b) and a != b:
+                return "sfb"
+            if abs(finger(a) - finger(b)) == 1 and abs(a // 12 - b // 12) == 2:
+                return "scissors"
+    return "same hand"
+
+
+def score(plans, unigrams, bigrams):
+    typed = {c: n for c, n in unigrams.items() if c in plans}
+    chars = sum(typed.values())
+    totals = Counter()
+    pairs = Counter()
+
+    for c, n in typed.items():
+        plan = plans[c]
+        totals["keystrokes"] += n * sum(len(chord) for chord in plan.presses)
+        totals[plan.kind] += n
+        chords = strokes(plan)
+        for first, second in zip(chords, chords[1:]):
+            pairs[pair_kind(first, second)] += n
+
+    for (a, b), n in bigrams.items():
+        if a not in plans or b not in plans:
+            continue
+        previous, plan = plans[a], plans[b]
+        if plan.symbols and not previous.symbols:
+            totals["switches"] += n
+        if plan.shift and not previous.shift:
+            totals["shifts"] += n
+        first, second = strokes(previous), strokes(plan)
+        if first and second:
+            pairs[pair_kind(first[-1], second[0])] += n
+
+    totals["keystrokes"] += totals["switches"] + totals["shifts"]
+    counted = sum(pairs.values()) or 1
+    per_k = 1000 / (chars or 1)
+    return {
+        "keystrokes": totals["keystrokes"] / (chars or 1),
+        "switches": totals["switches"] * per_k,
+        "shifts": totals["shifts"] * per_k,
+        "holds": totals["hold"] * per_k,
+        "corners": totals["corner"] * per_k,
+        "compose": totals["compose"] * per_k,
+        "sfb": 100 * pairs["sfb"] / counted,
+        "scissors": 100 * pairs["scissors"] / counted,
+        "alternation": 100 * pairs["alternation"] / counted,
+    }
+
+
+def printable(c):
+    return {" ": "Space", "\n": "Enter", "\t": "Tab"}.get(c, c if c.isprintable() else f"U+{ord(c):04X}")
+
+
+def report(layouts, results, unigrams, plans_by_layout, current):
+    width = max(12, *(len(layout) + 2 for layout in layouts))
+    print(f"{'':<24}" + "".join(f"{layout + ('*' if layout == current else ''):>{width}}" for layout in layouts))
+    for label, key in METRICS:
+        print(f"{label:<24}" + "".join(f"{results[layout][key]:>{width}.2f}" for layout in layouts))
+    print(f"{'untyped chars /1k':<24}", end="")
+    total = sum(n for c, n in unigrams.items() if c not in IGNORED) or 1
+    for layout in layouts:
+        missing = sum(n for c, n in unigrams.items() if c not in plans_by_layout[layout] and c not in IGNORED)
+        print(f"{1000 * missing / total:>{width}.2f}", end="")
+    print()
+    for layout in layouts:
+        missing = Counter({c: n for c, n in unigrams.items() if c not in IGNORED and c not in plans_by_layout[layout]})
+        if missing:
+            print(f"  untyped on {layout}: " + " ".join(f"{printable(c)} ({n})" for c, n in missing.most_common(8)))
+    if current in layouts:
+        print("* XC_LAYOUT")
+
+
+def report_symbols(layout, plans, unigrams):
+    total = sum(n for c, n in unigrams.items() if c not in IGNORED) or 1
+    per_position = Counter()
+    rows = []
+    for c, plan in plans.items():
+        if plan.symbols and unigrams[c]:
+            position = plan.presses[0][0]
+            per_position[position] += unigrams[c]
+            how = "held" if plan.kind == "hold" else "shifted" if plan.shift else "tapped"
+            rows.append((unigrams[c], c, position, how))
+    print(f"SYMBOLS, with {layout} on BASE: presses /1k chars per key")
+    for row in range(3):
+        cells = [f"{1000 * per_position[row * 12 + col] / total:6.1f}" if per_position[row * 12 + col] else "     ." for col in range(12)]
+        print(" ".join(cells[:6]) + "   " + " ".join(cells[6:]))
+    for n, c, position, how in sorted(rows, reverse=True):
+        where = f"{hand(position)} {FINGER_NAMES[finger(position)]}, row {position // 12}"
+        print(f"  {printable(c):<6} {1000 * n / total:8.2f}  key {position:02d} ({where}) {how}")
+
+
+def read_flags(overrides):
+    flags = dict(RULE_RE.findall((KEYMAP_DIR / "rules.mk").read_text()))
+    flags = {name: flags.get(name, "no") for name in FLAGS}
+    for override in overrides:
+        name, _, value = override.partition("=")
+        if name not in FLAGS or not value:
+            raise AnalyzeError(f"--set {override}: expected one of {', '.join(FLAGS)}=VALUE")
+        flags[name] = value
+    return flags
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("corpus", nargs="+", help="text files, or directories read recursively")
+    parser.add_argument("--layout", help="comma-separated layouts (default: every layouts/*.h)")
+    parser.add_argument("--symbols", action="store_true", help="SYMBOLS use per key with XC_LAYOUT (or the first --layout)")
+    parser.add_argument("--set", action="append", default=[], metavar="NAME=VALUE", help=f"override a rules.mk switch ({', '.join(FLAGS)})")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count(), help="processes (default: one per core)")
+    args = parser.parse_args()
+
+    flags = read_flags(args.set)
+    layouts = args.layout.split(",") if args.layout else sorted(p.stem for p in (KEYMAP_DIR / "layouts").glob("*.h"))
+    plans = {layout: Keymap(layout, flags).plans() for layout in layouts}
+
+    started = time.monotonic()
+    unigrams, bigrams, files = count_corpus(args.corpus, args.jobs)
+    chars = sum(unigrams.values())
+    print(f"{chars:,} characters in {files} files, counted in {time.monotonic() - started:.1f} s with {args.jobs} processes", file=sys.stderr)
+
+    if args.symbols:
+        layout = flags["XC_LAYOUT"] if not args.layout else layouts[0]
+        report_symbols(layout, plans.get(layout) or Keymap(layout, flags).plans(), unigrams)
+        return
+    results = {layout: score(plans[layout], unigrams, bigrams) for layout in layouts}
+    report(layouts, results, unigrams, plans, flags["XC_LAYOUT"])
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except AnalyzeError as e:
+        sys.exit(f"xc_analyze: {e}")
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""Follow the focused window and tell the keyboard which app context is active.
+
+Semantic keys (copy, word/line motions, deletions) have per-context sequences in the
+firmware: GUI, terminal, browser, editor. This daemon watches the X11 focused window
+(via `xprop -spy`), maps its WM_CLASS to a context and sends HL_CMD_SET_CONTEXT over
+raw HID whenever the context changes.
+
+    tools/xc_context_daemon.py            # run against the keyboard
+    tools/xc_context_daemon.py --dry-run  # print context changes, no keyboard needed
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+from xc_hid import CONTEXTS, HL_CMD_SET_CONTEXT, HidError, Keyboard
+
+# WM_CLASS (lowercase, class or instance) -> context; anything else is "gui"
+WINDOW_CLASSES = {
+    "terminal": ["alacritty", "kitty", "foot", "wezterm", "gnome-terminal-server", "konsole",
+                 "xterm", "urxvt", "st-256color", "tilix", "terminator", "ghostty"],
+    "browser": ["firefox", "chromium", "google-chrome", "brave-browser", "vivaldi-stable", "librewolf"],
+    "editor": ["code", "code-oss", "vscodium", "jetbrains-idea", "jetbrains-pycharm", "zed", "sublime_text"],
+}
+
+
+def context_for_class(wm_class):
+    names = [n.lower() for n in re.findall(r'"([^"]*)"', wm_class)]
+    for context, classes in WINDOW_CLASSES.items():
+        if any(name in classes for name in names):
+            return context
+    return "gui"
+
+
+def window_class(window_id):
+    try:
+        out = subprocess.run(["xprop", "-id", window_id, "WM_CLASS"],
+                             capture_output=True, text=True, check=True).stdout
+    except subprocess.CalledProcessError:
+        return ""
+    return out.partition("=")[2]
+
+
+def focused_windows():
+    """Yield the window id each time the focus changes."""
+    spy = subprocess.Popen(["xprop", "-root", "-spy", "_NET_ACTIVE_WINDOW"],
+                           stdout=subprocess.PIPE, text=True)
+    for line in spy.stdout:
+        match = re.search(r"window id # (0x[0-9a-f]+)", line)
+        if match and match.group(1) != "0x0":
+            yield match.group(1)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--dry-run", action="store_true", help="print context changes instead of sending them")
+    parser.add_argument("--device", help="hidraw device (default: auto-detect)")
+    args = parser.parse_args()
+
+    def send(context):
+        if args.dry_run:
+            print(context, flush=True)
+            return
+        with Keyboard(args.device) as kb:
+            kb.command(HL_CMD_SET_CONTEXT, CONTEXTS[context])
+
+    current = None
+    for window in focused_windows():
+        context = context_for_class(window_class(window))
+        if context == current:
+            continue
+        try:
+            send(context)
+            current = context
+        except HidError as e:
+            # Keyboard unplugged or switched away (KVM): retry on the next focus change
+            print(e, file=sys.stderr)
+            current = None
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except KeyboardInterrupt:
+        pass
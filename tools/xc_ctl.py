@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""Read and set the keyboard's OS, layout, compose and feature state.
+
+Replaces the ADJUST-layer round trip (SW_OS, SW_LYT, PR_OS, PR_LYT): switching to
+another machine is one command, and the answers come back as data instead of
+being typed into the focused window.
+
+    tools/xc_ctl.py                                # show the current state
+    tools/xc_ctl.py set --os mac --layout primary  # switch machines in one step
+    tools/xc_ctl.py set --feature combos=off       # runtime toggles
+    tools/xc_ctl.py --dry-run set --os linux       # print the packets, no keyboard needed
+    tools/xc_ctl.py boot                           # time from power-on to each boot phase
+"""
+
+import argparse
+import struct
+import sys
+
+from xc_hid import (BOOT_PHASES, BUILD_FLAGS, CONTEXTS, FEATURES, HL_CMD_GET_BOOT, HL_CMD_GET_COMPOSE,
+                    HL_CMD_GET_CONTEXT, HL_CMD_GET_FEATURES, HL_CMD_GET_LAYOUT, HL_CMD_GET_OS,
+                    HL_CMD_GET_VERSION, HL_CMD_SET_COMPOSE, HL_CMD_SET_CONTEXT, HL_CMD_SET_FEATURES, HL_CMD_SET_LAYOUT,
+                    HL_CMD_SET_OS, OSES, PROTOCOL_VERSION, HidError, Keyboard, payload_name)
+
+LAYOUTS = {"primary": 0, "secondary": 1}
+ON_OFF = {"on": 1, "off": 0}
+
+
+class DryRun:
+    """Stands in for Keyboard: prints each packet instead of sending it."""
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        pass
+
+    def command(self, command, *args):
+        print(" ".join(f"{b:02x}" for b in [command, *args]))
+        return bytes(30)
+
+
+def show(kb):
+    version = kb.command(HL_CMD_GET_VERSION)[0]
+    if version != PROTOCOL_VERSION:
+        raise HidError(f"firmware speaks protocol v{version}, this tool v{PROTOCOL_VERSION}")
+    os_ = kb.command(HL_CMD_GET_OS)
+    layout = kb.command(HL_CMD_GET_LAYOUT)
+    context = kb.command(HL_CMD_GET_CONTEXT)[0]
+    compose = kb.command(HL_CMD_GET_COMPOSE)[0]
+    features = kb.command(HL_CMD_GET_FEATURES)
+
+    print(f"os:       {payload_name(os_)}")
+    print(f"layout:   {payload_name(layout)} ({'secondary' if layout[0] else 'primary'})")
+    print(f"context:  {next((n for n, v in CONTEXTS.items() if v == context), context)}")
+    print(f"compose:  {'armed' if compose else 'off'}")
+    for name, bit in FEATURES.items():
+        print(f"{name + ':':<10}{'on' if features[0] & bit else 'off'}")
+    built = [name for name, bit in BUILD_FLAGS.items() if features[1] & bit]
+    print(f"build:    {', '.join(built) or '-'}")
+
+
+def boot(kb):
+    times = struct.unpack_from(f"<{len(BOOT_PHASES)}I", kb.command(HL_CMD_GET_BOOT))
+    for name, ms in zip(BOOT_PHASES, times):
+        print(f"{name + ':':<11}{f'{ms} ms' if ms else '-'}")
+
+
+def feature(value):
+    name, _, state = value.partition("=")
+    if name not in FEATURES or state not in ON_OFF:
+        raise argparse.ArgumentTypeError(f"expected one of {', '.join(FEATURES)} followed by =on or =off")
+    return FEATURES[name], ON_OFF[state]
+
+
+def apply(kb, args):
+    if args.os is not None:
+        kb.command(HL_CMD_SET_OS, OSES[args.os])
+    if args.layout is not None:
+        kb.command(HL_CMD_SET_LAYOUT, LAYOUTS[args.layout])
+    if args.context is not None:
+        kb.command(HL_CMD_SET_CONTEXT, CONTEXTS[args.context])
+    if args.compose is not None:
+        kb.command(HL_CMD_SET_COMPOSE, ON_OFF[args.compose])
+    if args.feature:
+        mask = values = 0
+        for bit, state in args.feature:
+            mask |= bit
+            values = (values | bit) if state else (values & ~bit)
+        kb.command(HL_CMD_SET_FEATURES, mask, values)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--device", help="hidraw device (default: auto-detect)")
+    parser.add_argument("--dry-run", action="store_true", help="print request packets instead of sending them")
+    sub = parser.add_subparsers(dest="action")
+    sub.add_parser("show", help="print the current state (default)")
+    sub.add_parser("boot", help="print the boot-phase timeline (ms since the timer started)")
+    setter = sub.add_parser("set", help="change one or more settings at once")
+    setter.add_argument("--os", choices=OSES)
+    setter.add_argument("--layout", choices=LAYOUTS)
+    setter.add_argument("--context", choices=CONTEXTS, help="semantic keys app context")
+    setter.add_argument("--compose", choices=ON_OFF, help="arm or cancel compose")
+    setter.add_argument("--feature", type=feature, action="append", metavar="NAME=on|off",
+                        help=f"runtime toggle: {', '.join(FEATURES)}")
+    args = parser.parse_args()
+
+    with (DryRun() if args.dry_run else Keyboard(args.device)) as kb:
+        if args.action == "set":
+            apply(kb, args)
+        if args.action == "boot":
+            boot(kb)
+        elif not args.dry_run:
+            show(kb)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except HidError as e:
+        sys.exit(f"xc_ctl: {e}")
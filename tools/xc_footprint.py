@@ -0,0 +1,230 @@
+#!/usr/bin/env python3
+"""Break down flash and RAM use of the userspace keymaps and gate them on budgets.
+
+Builds each qmk.json build target with `qmk compile`, then reads the sizes with the
+target's binutils `size`: totals from the ELF (flash = text + data, RAM = data + bss)
+and .text/.rodata/.data/.bss per userspace source file from its object file. Totals
+are compared with tools/footprint_budgets.json; the exit status is 1 when a target
+goes over its budget, has no budget recorded, or fails to build.
+
+    tools/xc_footprint.py                         # every qmk.json target
+    tools/xc_footprint.py -kb kaly/kaly42 -km crafted
+    tools/xc_footprint.py --flags                 # plus the cost of each XC_* yes/no option
+    tools/xc_footprint.py --record                # write current totals (+ headroom) as budgets
+    make footprint                                # same as the first line
+"""
+
+import argparse
+import json
+import re
+import subprocess
+import sys
+from concurrent.futures import ThreadPoolExecutor
+from pathlib import Path
+
+USERSPACE = Path(__file__).resolve().parent.parent
+BUDGETS = Path(__file__).resolve().parent / "footprint_budgets.json"
+
+RECORD_HEADROOM = 1.02  # budgets written by --record leave 2% above the measured totals
+SECTION_KINDS = ["text", "rodata", "data", "bss"]
+LOG_TAIL = 15
+
+# ELF e_machine -> binutils prefix
+SIZE_TOOLS = {40: "arm-none-eabi-size", 83: "avr-size"}
+
+# Boolean build options: "XC_NAME ?= yes|no" or "XC_NAME = yes|no" in rules.mk
+FLAG_RE = re.compile(r"^(XC_\w+)\s*\??=\s*(yes|no)\s*$", re.MULTILINE)
+
+
+class FootprintError(Exception):
+    pass
+
+
+def run(cmd):
+    result = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    return result.returncode, result.stdout
+
+
+def qmk_home():
+    status, output = run(["qmk", "config", "-ro", "user.qmk_home"])
+    home = output.strip().partition("=")[2]
+    if status != 0 or home in ("", "None"):
+        raise FootprintError("`qmk config -ro user.qmk_home` is not set")
+    return Path(home)
+
+
+def build_targets():
+    targets = json.loads((USERSPACE / "qmk.json").read_text())["build_targets"]
+    return [(target[0], target[1]) for target in targets]
+
+
+def target_name(keyboard, keymap, flag=None):
+    name = f"footprint_{keyboard.replace('/', '_')}_{keymap}"
+    return f"{name}_{flag[0]}_{flag[1]}" if flag else name
+
+
+def compile_target(keyboard, keymap, name, flag=None):
+    cmd = ["qmk", "compile", "-kb", keyboard, "-km", keymap, "-e", f"TARGET={name}"]
+    if flag:
+        cmd += ["-e", f"{flag[0]}={flag[1]}"]
+    status, output = run(cmd)
+    if status != 0:
+        tail = "\n".join(output.splitlines()[-LOG_TAIL:])
+        raise FootprintError(f"{' '.join(cmd)} failed:\n{tail}")
+
+
+def size_tool(elf):
+    with open(elf, "rb") as f:
+        header = f.read(20)
+    machine = int.from_bytes(header[18:20], "little")
+    if header[:4] != b"\x7fELF" or machine not in SIZE_TOOLS:
+        raise FootprintError(f"{elf}: not an ARM or AVR ELF file")
+    return SIZE_TOOLS[machine]
+
+
+def totals(tool, elf):
+    status, output = run([tool, "-B", str(elf)])
+    if status != 0:
+        raise FootprintError(output.strip())
+    text, data, bss = (int(v) for v in output.splitlines()[1].split()[:3])
+    return {"flash": text + data, "ram": data + bss}
+
+
+def section_kind(name):
+    if name.startswith(".progmem"):
+        return "rodata"  # AVR PROGMEM tables
+    for kind in SECTION_KINDS:
+        if name == f".{kind}" or name.startswith(f".{kind}."):
+            return kind
+    return None
+
+
+def object_sections(tool, obj):
+    status, output = run([tool, "-A", str(obj)])
+    if status != 0:
+        raise FootprintError(output.strip())
+    sizes = dict.fromkeys(SECTION_KINDS, 0)
+    for line in output.splitlines()[2:]:
+        fields = line.split()
+        if len(fields) >= 2 and fields[1].isdigit():
+            kind = section_kind(fields[0])
+            if kind:
+                sizes[kind] += int(fields[1])
+    return sizes
+
+
+def per_file(tool, objdir, keymap):
+    # Keymap sources are compiled under obj_<target>/, mirroring their path
+    marker = f"keymaps/{keymap}/"
+    files = {}
+    for obj in sorted(objdir.rglob("*.o")):
+        path = obj.as_posix()
+        if marker in path:
+            source = path.split(marker, 1)[1][:-2] + ".c"
+        elif "/users/" in path:
+            source = "users/" + path.split("/users/", 1)[1][:-2] + ".c"
+        else:
+            continue
+        files[source] = object_sections(tool, obj)
+    return files
+
+
+def measure(build_dir, keyboard, keymap, flag=None):
+    name = target_name(keyboard, keymap, flag)
+    compile_target(keyboard, keymap, name, flag)
+    elf = build_dir / f"{name}.elf"
+    tool = size_tool(elf)
+    files = None if flag else per_file(tool, build_dir / f"obj_{name}", keymap)
+    return totals(tool, elf), files
+
+
+def keymap_flags(keymap):
+    # Userspace defaults first, then the keymap's own settings, which take precedence
+    values = {}
+    for rules in (USERSPACE / "users" / "xcambar" / "rules.mk",
+                  USERSPACE / "keyboards" / "6x3_3" / "keymaps" / keymap / "rules.mk"):
+        if rules.exists():
+            values.update(FLAG_RE.findall(rules.read_text()))
+    return [(name, "no" if value == "yes" else "yes") for name, value in values.items()]
+
+
+def check_budget(total, budget):
+    # A target without a recorded budget fails too: an unmeasured gate passes anything
+    if any(budget.get(what) is None for what in total):
+        return "NO BUDGET (run --record)"
+    over = [what for what in total if total[what] > budget[what]]
+    return f"OVER BUDGET: {', '.join(over)}" if over else None
+
+
+def report(key, total, budget, failure, files, deltas):
+    limits = {what: f" / {budget[what]}" if budget.get(what) is not None else "" for what in total}
+    print(f"{key}  flash {total['flash']}{limits['flash']}  ram {total['ram']}{limits['ram']}  {failure or 'ok'}")
+    if files:
+        print(f"  {'file':<32}" + "".join(f"{kind:>8}" for kind in SECTION_KINDS))
+        for source, sizes in sorted(files.items(), key=lambda item: -sum(item[1].values())):
+            print(f"  {source:<32}" + "".join(f"{sizes[kind]:>8}" for kind in SECTION_KINDS))
+    for (name, value), delta in deltas.items():
+        if delta is None:
+            print(f"  {name}={value:<4} does not build for this target")
+        else:
+            print(f"  {name}={value:<4} flash {delta['flash']:+7}  ram {delta['ram']:+6}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-kb", "--keyboard", help="one keyboard instead of every qmk.json target")
+    parser.add_argument("-km", "--keymap", help="with --keyboard (default: crafted)")
+    parser.add_argument("--flags", action="store_true", help="also build each XC_* yes/no option flipped and show the delta")
+    parser.add_argument("--record", action="store_true", help=f"write the measured totals to {BUDGETS.name}")
+    parser.add_argument("--build-dir", type=Path, help="QMK build directory (default: <qmk_home>/.build)")
+    parser.add_argument("--jobs", type=int, default=1, help="parallel builds")
+    args = parser.parse_args()
+
+    targets = [(args.keyboard, args.keymap or "crafted")] if args.keyboard else build_targets()
+    build_dir = args.build_dir or qmk_home() / ".build"
+    budgets = json.loads(BUDGETS.read_text()) if BUDGETS.exists() else {}
+
+    with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        base = {t: pool.submit(measure, build_dir, *t) for t in targets}
+        flipped = {(t, f): pool.submit(measure, build_dir, *t, f)
+                   for t in targets if args.flags for f in keymap_flags(t[1])}
+
+        failed = False
+        for (keyboard, keymap), job in base.items():
+            key = f"{keyboard}:{keymap}"
+            try:
+                total, files = job.result()
+            except FootprintError as e:
+                print(f"{key}  BUILD FAILED\n{e}")
+                failed = True
+                continue
+            deltas = {}
+            for ((t, flag), flip_job) in flipped.items():
+                if t == (keyboard, keymap):
+                    try:
+                        flip_total = flip_job.result()[0]
+                    except FootprintError:
+                        deltas[flag] = None  # e.g. XC_EDGE_MATRIX on a matrix board: informational only
+                        continue
+                    deltas[flag] = {what: flip_total[what] - total[what] for what in total}
+            if args.record:
+                budgets[key] = {what: int(total[what] * RECORD_HEADROOM) for what in total}
+            budget = budgets.get(key) or {}
+            failure = check_budget(total, budget)
+            report(key, total, budget, failure, files, deltas)
+            failed |= failure is not None
+
+    if args.record:
+        BUDGETS.write_text(json.dumps(budgets, indent=4, sort_keys=True) + "\n")
+        print(f"budgets written to {BUDGETS}")
+    if failed:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except FootprintError as e:
+        sys.exit(f"xc_footprint: {e}")
+    except FileNotFoundError as e:
+        sys.exit(f"xc_footprint: {e.filename} not found (QMK CLI and toolchain needed)")
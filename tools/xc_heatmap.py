@@ -0,0 +1,90 @@
+#!/usr/bin/env python3
+"""Export the keyboard's per-key press counters as a keymap_drawer heatmap.
+
+Each layer becomes a keymap_drawer layer whose keys show their press count and share
+of the layer; keys are classed heat0 (unused) to heat9 (hottest) on a log scale, and
+the classes are coloured through draw_config.svg_extra_style.
+
+    tools/xc_heatmap.py > heatmap.yml && keymap draw heatmap.yml > heatmap.svg
+    tools/xc_heatmap.py --json   # raw counters
+    tools/xc_heatmap.py --reset  # clear counters (RAM and EEPROM)
+"""
+
+import argparse
+import json
+import math
+import struct
+import sys
+
+from xc_hid import HL_CMD_GET_HEATMAP, HL_CMD_RESET_HEATMAP, HidError, Keyboard
+
+# Must match HEATMAP_LAYERS / KEY_POSITION_COUNT and the layers enum in keymap.c
+LAYERS = ["BASE", "BASE_ALT", "FAVS", "SYMBOLS", "NAV_DEL", "ADJUST"]
+POSITIONS = 42
+
+HEAT_CLASSES = 10
+# Pale yellow to dark red
+HEAT_COLOURS = ["#f7f7f7", "#fff5cc", "#ffe699", "#ffd166", "#fdb04b",
+                "#f98e3a", "#f0672d", "#d9442a", "#b52a26", "#8c1a1f"]
+
+
+def read_counters(kb):
+    block = kb.read_pages(HL_CMD_GET_HEATMAP)
+    expected = len(LAYERS) * POSITIONS * 2
+    if len(block) != expected:
+        raise HidError(f"heatmap block is {len(block)} bytes, expected {expected}")
+    flat = struct.unpack(f"<{len(LAYERS) * POSITIONS}H", block)
+    return {name: list(flat[i * POSITIONS:(i + 1) * POSITIONS]) for i, name in enumerate(LAYERS)}
+
+
+def heat_class(count, peak):
+    if not count:
+        return 0
+    # log scale: 1 press is heat1, the busiest key heat9
+    return 1 + round((HEAT_CLASSES - 2) * math.log1p(count) / math.log1p(peak))
+
+
+def to_yaml(counters, per_layer):
+    peak_all = max(max(c) for c in counters.values()) or 1
+    lines = ["layout:", "    qmk_keyboard: cantor", "    layout_name: LAYOUT_split_3x6_3", "", "layers:"]
+    for name, counts in counters.items():
+        total = sum(counts)
+        if not total:
+            continue
+        peak = max(counts) if per_layer else peak_all
+        lines.append(f'    "{name} ({total})":')
+        for count in counts:
+            share = f"{100 * count / total:.1f}%"
+            lines.append(f'        - {{ t: "{count}", h: "{share}", type: heat{heat_class(count, peak)} }}')
+    lines += ["", "draw_config:", "    svg_extra_style: |"]
+    for level, colour in enumerate(HEAT_COLOURS):
+        lines.append(f"        rect.heat{level} {{ fill: {colour}; }}")
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--device", help="hidraw device (default: auto-detect)")
+    parser.add_argument("--json", action="store_true", help="print raw counters as JSON")
+    parser.add_argument("--per-layer", action="store_true",
+                        help="scale heat within each layer instead of across all layers")
+    parser.add_argument("--reset", action="store_true", help="clear the counters")
+    args = parser.parse_args()
+
+    with Keyboard(args.device) as kb:
+        if args.reset:
+            kb.command(HL_CMD_RESET_HEATMAP)
+            return
+        counters = read_counters(kb)
+
+    if args.json:
+        print(json.dumps(counters))
+    else:
+        sys.stdout.write(to_yaml(counters, args.per_layer))
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except HidError as e:
+        sys.exit(f"xc_heatmap: {e}")
@@ -0,0 +1,133 @@
+"""Raw HID transport shared by the host tools.
+
+Finds the keyboard's QMK raw HID interface (usage page 0xFF60, usage 0x61) among
+/dev/hidraw* and exchanges 32-byte packets with it. Linux only, standard library only.
+"""
+
+import glob
+import os
+import select
+
+RAW_EPSIZE = 32
+
+# Protocol, must match features/host_link.h
+PROTOCOL_VERSION = 1
+
+HL_CMD_GET_VERSION = 0x00
+HL_CMD_SET_CONTEXT = 0x01
+HL_CMD_GET_CONTEXT = 0x02
+HL_CMD_GET_OS = 0x03
+HL_CMD_SET_OS = 0x04
+HL_CMD_GET_LAYOUT = 0x05
+HL_CMD_SET_LAYOUT = 0x06
+HL_CMD_GET_COMPOSE = 0x07
+HL_CMD_SET_COMPOSE = 0x08
+HL_CMD_GET_FEATURES = 0x09
+HL_CMD_SET_FEATURES = 0x0A
+HL_CMD_GET_TELEMETRY = 0x0B
+HL_CMD_RESET_TELEMETRY = 0x0C
+HL_CMD_GET_HEATMAP = 0x0D
+HL_CMD_RESET_HEATMAP = 0x0E
+HL_CMD_GET_DEBOUNCE = 0x0F
+HL_CMD_RESET_DEBOUNCE = 0x10
+HL_CMD_GET_MATRIX = 0x11
+HL_CMD_RESET_MATRIX = 0x12
+HL_CMD_GET_BOOT = 0x13
+HL_CMD_GET_TUNABLES = 0x14
+HL_CMD_SET_TUNABLE = 0x15
+HL_CMD_SAVE_TUNABLES = 0x16
+HL_CMD_RESET_TUNABLES = 0x17
+
+STATUS = {0x00: "ok", 0x01: "unknown command", 0x02: "invalid value"}
+
+# Must match semkey_context_t (semantic_keys.h) and os_platform_t (os_control.h)
+CONTEXTS = {"gui": 0, "terminal": 1, "browser": 2, "editor": 3}
+OSES = {"mac": 0, "linux": 1}
+
+# Must match boot_phase_t (boot_profile.h)
+BOOT_PHASES = ["pre_init", "post_init", "usb", "deferred", "first_key"]
+
+# Must match TUNABLES_LIST (tunables.h), in id order
+TUNABLES = ["tapping-term", "flow-tap-term", "combo-term", "sl-hold-shift", "flags"]
+TUNABLE_FLAGS = {"weak-corners": 1 << 0, "alt-base-symbols": 1 << 1}
+
+# Runtime feature flags and read-only build flags (GET/SET_FEATURES)
+FEATURES = {"combos": 1 << 0, "key-overrides": 1 << 1}
+BUILD_FLAGS = {"weak-corners": 1 << 0, "alt-base-symbols": 1 << 1, "word-chords": 1 << 2,
+               "telemetry": 1 << 3, "heatmap": 1 << 4, "eager-debounce": 1 << 5,
+               "edge-matrix": 1 << 6, "tunables": 1 << 7}
+
+# Report descriptor prefix of QMK's raw HID interface: Usage Page (0xFF60), Usage (0x61)
+RAW_HID_DESCRIPTOR = bytes([0x06, 0x60, 0xFF, 0x09, 0x61])
+
+
+class HidError(Exception):
+    pass
+
+
+def find_device():
+    """Return the /dev/hidraw path of the first QMK raw HID interface."""
+    for sysfs in sorted(glob.glob("/sys/class/hidraw/hidraw*")):
+        try:
+            with open(os.path.join(sysfs, "device", "report_descriptor"), "rb") as f:
+                descriptor = f.read()
+        except OSError:
+            continue
+        if descriptor.startswith(RAW_HID_DESCRIPTOR):
+            return os.path.join("/dev", os.path.basename(sysfs))
+    raise HidError("no QMK raw HID interface found (is XC_HOST_LINK enabled and the keyboard plugged in?)")
+
+
+class Keyboard:
+    """A raw HID connection; use as a context manager."""
+
+    def __init__(self, path=None, timeout=1.0):
+        self.path = path or find_device()
+        self.timeout = timeout
+        self.fd = None
+
+    def __enter__(self):
+        try:
+            self.fd = os.open(self.path, os.O_RDWR)
+        except OSError as e:
+            raise HidError(f"cannot open {self.path}: {e.strerror} (check udev permissions)") from e
+        return self
+
+    def __exit__(self, *exc):
+        os.close(self.fd)
+
+    def request(self, payload):
+        """Send one packet (command byte first) and return the 32-byte reply."""
+        packet = bytes(payload)[:RAW_EPSIZE].ljust(RAW_EPSIZE, b"\0")
+        # Report ID 0 prefix: the kernel strips it, QMK's raw HID has no report IDs
+        os.write(self.fd, b"\0" + packet)
+        ready, _, _ = select.select([self.fd], [], [], self.timeout)
+        if not ready:
+            raise HidError("no reply from the keyboard")
+        reply = os.read(self.fd, RAW_EPSIZE)
+        if reply[0] != packet[0]:
+            raise HidError(f"unexpected reply to command 0x{packet[0]:02x}: 0x{reply[0]:02x}")
+        return reply
+
+    def command(self, command, *args):
+        """Send a command and return its payload; raises HidError on a failed status."""
+        reply = self.request([command, *args])
+        if reply[1] != 0:
+            raise HidError(f"command 0x{command:02x} failed: {STATUS.get(reply[1], reply[1])}")
+        return reply[2:]
+
+    def read_pages(self, command):
+        """Reassemble a block paged out as [page count, bytes, slice...] replies."""
+        block = b""
+        page, pages = 0, 1
+        while page < pages:
+            payload = self.command(command, page)
+            pages, size = payload[0], payload[1]
+            block += payload[2:2 + size]
+            page += 1
+        return block
+
+
+def payload_name(payload):
+    """Decode the NUL-terminated name that follows the value byte of a payload."""
+    return payload[1:].split(b"\0", 1)[0].decode("ascii", "replace")
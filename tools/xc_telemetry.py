@@ -0,0 +1,203 @@
+#!/usr/bin/env python3
+"""Read the keyboard's typing statistics: WPM, key intervals, mod-tap holds, combos.
+
+Meant for TAPPING_TERM / FLOW_TAP_TERM tuning: type normally for a while, then look at
+where taps and holds of each mod-tap land relative to the terms in config.h.
+
+    tools/xc_telemetry.py             # print the statistics
+    tools/xc_telemetry.py --watch 5   # refresh every 5 seconds
+    tools/xc_telemetry.py --json      # machine-readable dump
+    tools/xc_telemetry.py --reset     # clear the accumulators
+    tools/xc_telemetry.py --debounce  # debounce latency and chatter (XC_EAGER_DEBOUNCE)
+    tools/xc_telemetry.py --matrix    # scans vs pin reads, edge latency (XC_EDGE_MATRIX)
+"""
+
+import argparse
+import json
+import struct
+import sys
+import time
+
+from xc_hid import (HL_CMD_GET_DEBOUNCE, HL_CMD_GET_MATRIX, HL_CMD_GET_TELEMETRY,
+                    HL_CMD_RESET_DEBOUNCE, HL_CMD_RESET_MATRIX, HL_CMD_RESET_TELEMETRY, HidError,
+                    Keyboard)
+
+# Must match telemetry_t in features/telemetry.h
+TELEMETRY_VERSION = 3
+INTERVAL_BUCKETS = 16
+HOLD_POSITIONS = (16, 19, 26, 27, 28, 31, 32, 33)
+HOLD_BUCKETS = 16
+MAX_COMBOS = 8
+LAYOUT = struct.Struct(f"<BBBBIIHH{MAX_COMBOS}H{MAX_COMBOS}H{INTERVAL_BUCKETS}H"
+                       f"{len(HOLD_POSITIONS) * 2 * HOLD_BUCKETS}H")
+
+
+def decode(block):
+    if len(block) != LAYOUT.size:
+        raise HidError(f"telemetry block is {len(block)} bytes, expected {LAYOUT.size}")
+    fields = LAYOUT.unpack(block)
+    version, wpm, wpm_peak, bucket_ms, keypresses, scan_rate, split_sent, split_saved = fields[:8]
+    if version != TELEMETRY_VERSION:
+        raise HidError(f"firmware telemetry v{version}, this tool v{TELEMETRY_VERSION}")
+    rest = fields[8:]
+    hits, rest = rest[:MAX_COMBOS], rest[MAX_COMBOS:]
+    misses, rest = rest[:MAX_COMBOS], rest[MAX_COMBOS:]
+    intervals, rest = rest[:INTERVAL_BUCKETS], rest[INTERVAL_BUCKETS:]
+    holds = {}
+    for i, pos in enumerate(HOLD_POSITIONS):
+        base = i * 2 * HOLD_BUCKETS
+        holds[pos] = {"tap": list(rest[base:base + HOLD_BUCKETS]),
+                      "hold": list(rest[base + HOLD_BUCKETS:base + 2 * HOLD_BUCKETS])}
+    return {"wpm": wpm, "wpm_peak": wpm_peak, "keypresses": keypresses, "scan_rate": scan_rate,
+            "split_bytes_sent": split_sent, "split_bytes_saved": split_saved, "hold_bucket_ms": bucket_ms,
+            "combos": [{"hits": h, "misses": m} for h, m in zip(hits, misses)],
+            "intervals": list(intervals), "holds": holds}
+
+# Must match debounce_stats_t in features/eager_debounce.h (per-key chatter follows)
+DEBOUNCE_HEADER = struct.Struct("<BBBBIIII")
+
+
+def decode_debounce(block):
+    (debounce_ms, rows, cols, release_max,
+     press_count, release_sum, release_count, bounces) = DEBOUNCE_HEADER.unpack_from(block)
+    chatter = block[DEBOUNCE_HEADER.size:DEBOUNCE_HEADER.size + rows * cols]
+    return {"debounce_ms": debounce_ms, "bounces": bounces, "presses": press_count,
+            "release_latency": {"count": release_count, "max": release_max,
+                                "mean": release_sum / release_count if release_count else 0},
+            "chatter": {f"{i // cols},{i % cols}": n for i, n in enumerate(chatter) if n}}
+
+
+def report_debounce(stats):
+    print(f"Debounce {stats['debounce_ms']} ms, {stats['bounces']} bounces absorbed")
+    latency = stats["release_latency"]
+    print(f"  {stats['presses']} presses, reported on the scan that saw them")
+    print(f"  release latency: mean {latency['mean']:.1f} ms, max {latency['max']} ms "
+          f"over {latency['count']}")
+    if stats["chatter"]:
+        print("  chatter (matrix row,col: count):")
+        for key, count in sorted(stats["chatter"].items(), key=lambda kv: -kv[1]):
+            print(f"    {key}: {count}")
+    else:
+        print("  no chatter")
+
+# Must match edge_matrix_stats_t in features/edge_matrix.h
+MATRIX_LAYOUT = struct.Struct("<IIIIHH")
+
+
+def decode_matrix(payload):
+    scans, reads, edges, latency_sum, latency_max, rescan_ms = MATRIX_LAYOUT.unpack_from(payload)
+    return {"scans": scans, "reads": reads, "edges": edges, "rescan_ms": rescan_ms,
+            "edge_latency_us": {"mean": latency_sum / edges if edges else 0, "max": latency_max}}
+
+
+def report_matrix(stats):
+    scans = stats["scans"] or 1
+    print(f"Edge matrix: {stats['scans']} scans, {stats['reads']} pin reads "
+          f"({100 * stats['reads'] / scans:.2f}%), {stats['edges']} after an edge, "
+          f"rescan every {stats['rescan_ms']} ms")
+    latency = stats["edge_latency_us"]
+    print(f"  edge to read: mean {latency['mean']:.0f} us, max {latency['max']} us")
+
+
+def bar(count, peak, width=40):
+    return "#" * (round(width * count / peak) if peak else 0)
+
+
+def interval_label(bucket):
+    if bucket <= 1:
+        return f"{bucket} ms"
+    if bucket == INTERVAL_BUCKETS - 1:
+        return f">= {1 << (bucket - 1)} ms"
+    return f"{1 << (bucket - 1)}-{(1 << bucket) - 1} ms"
+
+
+def percentile_bucket(histogram, fraction):
+    total = sum(histogram)
+    if not total:
+        return None
+    running = 0
+    for bucket, count in enumerate(histogram):
+        running += count
+        if running >= fraction * total:
+            return bucket
+    return len(histogram) - 1
+
+
+def report(stats):
+    print(f"WPM {stats['wpm']} (peak {stats['wpm_peak']}), {stats['keypresses']} keypresses")
+    if stats["scan_rate"]:
+        print(f"Matrix scan rate {stats['scan_rate']}/s")
+    if stats["split_bytes_sent"] or stats["split_bytes_saved"]:
+        print(f"Split state sync {stats['split_bytes_sent']} B/s ({stats['split_bytes_saved']} B/s saved)")
+    print()
+
+    print("Interval between presses")
+    peak = max(stats["intervals"])
+    for bucket, count in enumerate(stats["intervals"]):
+        if count:
+            print(f"  {interval_label(bucket):>13} {count:6} {bar(count, peak)}")
+
+    step = stats["hold_bucket_ms"]
+    print(f"\nMod-tap press durations ({step} ms buckets; p95 of taps, p5 of holds)")
+    for pos, hist in stats["holds"].items():
+        taps, holds = sum(hist["tap"]), sum(hist["hold"])
+        if not taps and not holds:
+            continue
+        p95 = percentile_bucket(hist["tap"], 0.95)
+        p5 = percentile_bucket(hist["hold"], 0.05)
+        tap_edge = f"<{(p95 + 1) * step} ms" if p95 is not None else "-"
+        hold_edge = f">={p5 * step} ms" if p5 is not None else "-"
+        print(f"  pos {pos:2}: {taps:6} taps {tap_edge:>9}   {holds:6} holds {hold_edge:>9}")
+
+    print("\nCombos (by combo index)")
+    for index, combo in enumerate(stats["combos"]):
+        if combo["hits"] or combo["misses"]:
+            print(f"  {index}: {combo['hits']:6} hits {combo['misses']:6} misses")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--device", help="hidraw device (default: auto-detect)")
+    parser.add_argument("--json", action="store_true", help="print the decoded block as JSON")
+    parser.add_argument("--watch", type=float, metavar="SECONDS", help="refresh periodically")
+    parser.add_argument("--reset", action="store_true", help="clear the accumulators")
+    parser.add_argument("--debounce", action="store_true",
+                        help="show (or with --reset, clear) the debounce instrumentation instead")
+    parser.add_argument("--matrix", action="store_true",
+                        help="show (or with --reset, clear) the edge matrix instrumentation instead")
+    args = parser.parse_args()
+
+    with Keyboard(args.device) as kb:
+        if args.reset:
+            if args.debounce:
+                kb.command(HL_CMD_RESET_DEBOUNCE)
+            elif args.matrix:
+                kb.command(HL_CMD_RESET_MATRIX)
+            else:
+                kb.command(HL_CMD_RESET_TELEMETRY)
+            return
+        while True:
+            if args.debounce:
+                stats, show = decode_debounce(kb.read_pages(HL_CMD_GET_DEBOUNCE)), report_debounce
+            elif args.matrix:
+                stats, show = decode_matrix(kb.command(HL_CMD_GET_MATRIX)), report_matrix
+            else:
+                stats, show = decode(kb.read_pages(HL_CMD_GET_TELEMETRY)), report
+            if args.json:
+                print(json.dumps(stats))
+            else:
+                if args.watch:
+                    print("\033[H\033[J", end="")
+                show(stats)
+            if not args.watch:
+                break
+            time.sleep(args.watch)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except HidError as e:
+        sys.exit(f"xc_telemetry: {e}")
+    except KeyboardInterrupt:
+        pass
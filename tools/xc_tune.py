@@ -0,0 +1,113 @@
+#!/usr/bin/env python3
+"""Read, edit and save the keyboard's timing parameters and feature toggles.
+
+Changes apply as soon as they are sent, so a tapping term can be tried while typing;
+`save` writes the current values to EEPROM, where they survive a power cycle. On a
+split keyboard, the half on USB also copies them to the other half's EEPROM, retrying
+until the halves are connected (not across a power cycle).
+Nothing is rebuilt or reflashed.
+
+    tools/xc_tune.py                                   # show the current values
+    tools/xc_tune.py set tapping-term=220 combo-term=40
+    tools/xc_tune.py set weak-corners=off              # feature toggles by name
+    tools/xc_tune.py save                              # persist the current values
+    tools/xc_tune.py reset                             # back to the build defaults (then save)
+    tools/xc_tune.py --dry-run set flow-tap-term=120   # print the packets, no keyboard needed
+"""
+
+import argparse
+import struct
+import sys
+
+from xc_hid import (BUILD_FLAGS, HL_CMD_GET_FEATURES, HL_CMD_GET_TUNABLES, HL_CMD_RESET_TUNABLES,
+                    HL_CMD_SAVE_TUNABLES, HL_CMD_SET_TUNABLE, TUNABLE_FLAGS, TUNABLES, HidError, Keyboard)
+
+ON_OFF = {"on": 1, "off": 0}
+
+
+class DryRun:
+    """Stands in for Keyboard: prints each packet and answers with the values unchanged."""
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        pass
+
+    def command(self, command, *args):
+        print(" ".join(f"{b:02x}" for b in [command, *args]))
+        return bytes([len(TUNABLES)]) + bytes(29)
+
+
+def decode(payload):
+    count = payload[0]
+    if count != len(TUNABLES):
+        raise HidError(f"firmware has {count} tunables, this tool knows {len(TUNABLES)}")
+    return dict(zip(TUNABLES, struct.unpack_from(f"<{count}H", payload, 1)))
+
+
+def assignment(value):
+    name, _, setting = value.partition("=")
+    if name in TUNABLE_FLAGS and setting in ON_OFF:
+        return name, ON_OFF[setting]
+    if name in TUNABLES and name != "flags" and setting.isdigit():
+        return name, int(setting)
+    names = [t for t in TUNABLES if t != "flags"]
+    raise argparse.ArgumentTypeError(f"expected NAME=ms with NAME one of {', '.join(names)}, "
+                                     f"or a toggle ({', '.join(TUNABLE_FLAGS)}) =on or =off")
+
+
+def show(values):
+    for name in TUNABLES:
+        if name == "flags":
+            for flag, bit in TUNABLE_FLAGS.items():
+                print(f"{flag + ':':<18}{'on' if values['flags'] & bit else 'off'}")
+        else:
+            print(f"{name + ':':<18}{values[name]} ms")
+
+
+def apply(kb, assignments):
+    values = decode(kb.command(HL_CMD_GET_TUNABLES))
+    for name, value in assignments:
+        if name in TUNABLE_FLAGS:
+            bit = TUNABLE_FLAGS[name]
+            name, value = "flags", (values["flags"] | bit) if value else (values["flags"] & ~bit)
+        try:
+            values = decode(kb.command(HL_CMD_SET_TUNABLE, TUNABLES.index(name), value & 0xFF, value >> 8))
+        except HidError as e:
+            raise HidError(f"{name}={value}: {e}") from e
+    return values
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--device", help="hidraw device (default: auto-detect)")
+    parser.add_argument("--dry-run", action="store_true", help="print request packets instead of sending them")
+    sub = parser.add_subparsers(dest="action")
+    sub.add_parser("show", help="print the current values (default)")
+    setter = sub.add_parser("set", help="change values live (not saved)")
+    setter.add_argument("assignments", type=assignment, nargs="+", metavar="NAME=VALUE")
+    sub.add_parser("save", help="write the current values to EEPROM")
+    sub.add_parser("reset", help="back to the build defaults (not saved)")
+    args = parser.parse_args()
+
+    with (DryRun() if args.dry_run else Keyboard(args.device)) as kb:
+        if not args.dry_run and not kb.command(HL_CMD_GET_FEATURES)[1] & BUILD_FLAGS["tunables"]:
+            raise HidError("firmware built without XC_TUNABLES")
+        if args.action == "set":
+            values = apply(kb, args.assignments)
+        elif args.action == "save":
+            values = decode(kb.command(HL_CMD_SAVE_TUNABLES))
+        elif args.action == "reset":
+            values = decode(kb.command(HL_CMD_RESET_TUNABLES))
+        else:
+            values = decode(kb.command(HL_CMD_GET_TUNABLES))
+        if not args.dry_run:
+            show(values)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except HidError as e:
+        sys.exit(f"xc_tune: {e}")
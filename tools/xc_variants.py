@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Build every layout and feature-flag variant of the crafted keymap, in parallel.
+
+The keymap is built for one combination of XC_LAYOUT, XC_SECONDARY_LAYOUT,
+XC_WEAK_CORNERS and XC_ALT_BASE_SYMBOLS at a time; this compiles all 100 of them
+(5 x 5 x 2 x 2) with `qmk compile`, one job per core, and lists the ones that fail.
+Each variant gets its own TARGET, so parallel builds don't share object files.
+
+    tools/xc_variants.py                          # every variant, kaly/kaly42
+    tools/xc_variants.py -kb 42keebs/cantor_pro/v3/left --jobs 4
+    tools/xc_variants.py --only XC_LAYOUT=graphite --only XC_WEAK_CORNERS=no
+    tools/xc_variants.py --dry-run                # print the commands only
+"""
+
+import argparse
+import itertools
+import os
+import subprocess
+import sys
+from concurrent.futures import ThreadPoolExecutor, as_completed
+
+# Must match the choices documented in rules.mk
+LAYOUTS = ["qwerty", "gallium", "gallium_east", "focal", "graphite"]
+YES_NO = ["yes", "no"]
+VARIANT_OPTIONS = {
+    "XC_LAYOUT": LAYOUTS,
+    "XC_SECONDARY_LAYOUT": LAYOUTS,
+    "XC_WEAK_CORNERS": YES_NO,
+    "XC_ALT_BASE_SYMBOLS": YES_NO,
+}
+
+LOG_TAIL = 15  # lines of a failed build's output to show
+
+
+def variants(only):
+    choices = {name: [only[name]] if name in only else values for name, values in VARIANT_OPTIONS.items()}
+    for combination in itertools.product(*choices.values()):
+        yield dict(zip(choices, combination))
+
+
+def variant_tag(variant):
+    return "_".join(value for value in variant.values())
+
+
+def command(keyboard, keymap, variant):
+    cmd = ["qmk", "compile", "-kb", keyboard, "-km", keymap]
+    # Passed as make variables, which override rules.mk assignments (not only ?=)
+    for name, value in variant.items():
+        cmd += ["-e", f"{name}={value}"]
+    cmd += ["-e", f"TARGET={keymap}_{variant_tag(variant)}"]
+    return cmd
+
+
+def build(cmd):
+    result = subprocess.run(cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+    return result.returncode, result.stdout
+
+
+def only_option(value):
+    name, _, choice = value.partition("=")
+    if name not in VARIANT_OPTIONS or choice not in VARIANT_OPTIONS[name]:
+        raise argparse.ArgumentTypeError(f"expected NAME=value with NAME one of {', '.join(VARIANT_OPTIONS)}")
+    return name, choice
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("-kb", "--keyboard", default="kaly/kaly42")
+    parser.add_argument("-km", "--keymap", default="crafted")
+    parser.add_argument("--jobs", type=int, default=os.cpu_count(), help="parallel builds (default: one per core)")
+    parser.add_argument("--only", type=only_option, action="append", default=[], metavar="NAME=value",
+                        help="pin one option instead of trying all its values")
+    parser.add_argument("--dry-run", action="store_true", help="print the build commands instead of running them")
+    args = parser.parse_args()
+
+    commands = {variant_tag(v): command(args.keyboard, args.keymap, v) for v in variants(dict(args.only))}
+    if args.dry_run:
+        for cmd in commands.values():
+            print(" ".join(cmd))
+        return
+
+    failed = {}
+    with ThreadPoolExecutor(max_workers=args.jobs) as pool:
+        jobs = {pool.submit(build, cmd): tag for tag, cmd in commands.items()}
+        for done, job in enumerate(as_completed(jobs), 1):
+            tag = jobs[job]
+            status, output = job.result()
+            print(f"[{done}/{len(jobs)}] {'ok  ' if status == 0 else 'FAIL'} {tag}", flush=True)
+            if status != 0:
+                failed[tag] = output
+
+    for tag, output in sorted(failed.items()):
+        print(f"\n--- {tag}: {' '.join(commands[tag])}")
+        print("\n".join(output.splitlines()[-LOG_TAIL:]))
+    print(f"\n{len(commands) - len(failed)}/{len(commands)} variants built")
+    if failed:
+        sys.exit(1)
+
+
+if __name__ == "__main__":
+    try:
+        main()
+    except FileNotFoundError as e:
+        sys.exit(f"xc_variants: {e.filename} not found (is the QMK CLI installed?)")
@@ -13,7 +13,7 @@
 
 #ifdef XC_ALT_BASE_SYMBOLS
 
-// Alternative symbols list using CUSTOM_KEYCODES macro from custom_keycodes.h
+// Alternative symbols list using CUSTOM_KEYCODES macro from xcambar.h
 // Expands to: _ALT_SYMBOLS_START, AS_QUOT, ..., _ALT_SYMBOLS_COUNT
 #define ALT_SYMBOLS_LIST CUSTOM_KEYCODES(ALT_SYMBOLS, \
         AS_QUOT, \
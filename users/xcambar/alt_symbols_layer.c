@@ -0,0 +1,80 @@
+#include "xcambar.h"
+
+// Hold-to-shift for the SL_* keys: one key at a time is pending, from its press
+// to its release; it is settled (typed) at most once, by release, timeout or roll.
+// A roll settles the pending key and the next SL_* key becomes pending, so several
+// can be down at once: each one's release is swallowed, by position.
+
+static const sl_pair_t *sl_pending = NULL;  // pair of the key being held
+static keypos_t         sl_pending_key;
+static uint16_t         sl_pending_time;
+static uint16_t         sl_pending_timeout;
+static bool             sl_settled = false;     // already typed, waiting for the release
+static matrix_row_t     sl_down[MATRIX_ROWS];  // SL_* keys whose press was taken here
+
+__attribute__((weak)) uint16_t get_sl_hold_shift_timeout(uint16_t keycode, keyrecord_t *record) {
+    return SL_HOLD_SHIFT_TIMEOUT;
+}
+
+static const sl_pair_t *sl_find_pair(uint16_t keycode) {
+    for (uint8_t i = 0; i < sl_pair_count; i++) {
+        if (sl_pairs[i].trigger == keycode) {
+            return &sl_pairs[i];
+        }
+    }
+    return NULL;
+}
+
+static void sl_settle(bool shifted) {
+    if (!sl_settled) {
+        tap_code16(shifted ? sl_pending->shifted : sl_pending->unshifted);
+        sl_settled = true;
+    }
+}
+
+bool process_sl_hold_shift(uint16_t keycode, keyrecord_t *record) {
+    keypos_t     key = record->event.key;
+    matrix_row_t bit = (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) ? MATRIX_ROW_SHIFTER << key.col : 0;
+
+    if (!record->event.pressed) {
+        if (!bit || !(sl_down[key.row] & bit)) {
+            return true;
+        }
+        sl_down[key.row] &= ~bit;
+        if (sl_pending && KEYEQ(key, sl_pending_key)) {
+            sl_settle(false);
+            sl_pending = NULL;
+        }
+        return false;  // its press was taken here
+    }
+
+    if (sl_pending) {
+        sl_settle(false);  // roll: the held key was a tap, and types first
+        sl_pending = NULL;
+    }
+
+    if (!bit || keycode <= LIST_START_MARKER(ALT_SYMBOLS_LAYER) || keycode >= LIST_LENGTH(ALT_SYMBOLS_LAYER)) {
+        return true;  // not an SL_* key, or not from the matrix (combo)
+    }
+    if ((get_mods() | get_oneshot_mods()) & MOD_MASK_SHIFT) {
+        return true;  // explicit Shift: the key overrides type the shifted partner
+    }
+    const sl_pair_t *pair = sl_find_pair(keycode);
+    if (!pair) {
+        return true;
+    }
+
+    sl_down[key.row] |= bit;
+    sl_pending         = pair;
+    sl_pending_key     = key;
+    sl_pending_time    = timer_read();
+    sl_pending_timeout = get_sl_hold_shift_timeout(keycode, record);
+    sl_settled         = false;
+    return false;
+}
+
+void sl_hold_shift_task(void) {
+    if (sl_pending && !sl_settled && timer_elapsed(sl_pending_time) >= sl_pending_timeout) {
+        sl_settle(true);
+    }
+}
@@ -0,0 +1,101 @@
+// Alternative SYMBOLS layer feature
+// Custom keycodes with non-standard shift behavior for SYMBOLS layer
+//
+// Design goals:
+// - Clean API: macros hide complexity
+// - Compile-time initialization: key overrides generated statically
+// - One pair table: the keymap lists its pairs once, as an X-macro expanded with
+//   SL_OVERRIDE_ROW (key overrides) and SL_PAIR_ROW (hold-to-shift)
+//
+// Hold-to-shift (XC_SL_HOLD_SHIFT): holding an SL_* key past its timeout types the
+// shifted partner, so the symbols layer needs no Shift thumb. The key types on
+// release (unshifted) or on timeout (shifted); pressing another key first settles
+// it as a tap, so rolls keep their order. With Shift held, the key overrides apply
+// as usual.
+//
+// Usage:
+// 1. XC_ALT_SYMBOLS_LAYER = yes (and XC_SL_HOLD_SHIFT = yes) in the keymap's rules.mk
+// 2. Define the pairs as an X-macro: #define SL_PAIRS(X) X(SL_AT, KC_AT, KC_HASH) ...
+// 3. Expand SL_PAIRS(SL_OVERRIDE_ROW) in key_overrides[]
+// 4. For hold-to-shift: define sl_pairs[] from SL_PAIRS(SL_PAIR_ROW) and
+//    sl_pair_count, call process_sl_hold_shift() early in process_record_user()
+//    and sl_hold_shift_task() from housekeeping_task_user()
+
+#pragma once
+
+#include <stdint.h>
+#include "quantum.h"
+
+#ifdef XC_ALT_SYMBOLS_LAYER
+
+// Layer the overrides apply to (the keymap's layer enum must be visible where they expand)
+#ifndef ALT_SYMBOLS_LAYER
+#    define ALT_SYMBOLS_LAYER SYMBOLS
+#endif
+
+// Alternative symbols layer keycodes using CUSTOM_KEYCODES macro from xcambar.h
+#define ALT_SYMBOLS_LAYER_LIST CUSTOM_KEYCODES(ALT_SYMBOLS_LAYER, \
+        SL_AT, \
+        SL_GRV, \
+        SL_EQL, \
+        SL_DLR, \
+        SL_AMPR, \
+        SL_BSLS, \
+        SL_LPRN, \
+        SL_RPRN, \
+        SL_LBRC, \
+        SL_RBRC, \
+        SL_SCLN \
+    )
+
+// Macro to generate a pair of key overrides for a symbols layer key
+// Applied only to ALT_SYMBOLS_LAYER
+// Usage: SL_OVERRIDE(SL_1, KC_1, KC_AT)
+#define SL_OVERRIDE(trigger, unshifted, shifted) \
+    &ko_make_with_layers_and_negmods( \
+        0, trigger, unshifted, 1 << ALT_SYMBOLS_LAYER, MOD_MASK_SHIFT \
+    ), \
+    &ko_make_with_layers( \
+        MOD_MASK_SHIFT, trigger, shifted, 1 << ALT_SYMBOLS_LAYER \
+    )
+
+// Row of key_overrides[] for one pair of the keymap's SL_PAIRS table
+#define SL_OVERRIDE_ROW(trigger, unshifted, shifted) SL_OVERRIDE(trigger, unshifted, shifted),
+
+typedef struct {
+    uint16_t trigger;
+    uint16_t unshifted;
+    uint16_t shifted;
+} sl_pair_t;
+
+// Row of sl_pairs[] for one pair of the keymap's SL_PAIRS table
+#define SL_PAIR_ROW(trigger, unshifted, shifted) { trigger, unshifted, shifted },
+
+#endif // XC_ALT_SYMBOLS_LAYER
+
+#ifndef SL_HOLD_SHIFT_TIMEOUT
+#    define SL_HOLD_SHIFT_TIMEOUT 200  // ms held before an SL_* key types its shifted partner
+#endif
+
+#ifdef XC_SL_HOLD_SHIFT
+// To be implemented by the consumer: the pairs hold-to-shift applies to
+extern const sl_pair_t sl_pairs[];
+extern const uint8_t   sl_pair_count;
+
+// To be implemented by the consumer (optional). Hold time for the key at this
+// position, SL_HOLD_SHIFT_TIMEOUT by default.
+uint16_t get_sl_hold_shift_timeout(uint16_t keycode, keyrecord_t *record);
+
+// Process hold-to-shift - call from process_record_user() before features that
+// swallow keys. Returns false when the key was handled.
+bool process_sl_hold_shift(uint16_t keycode, keyrecord_t *record);
+
+// Type the shifted partner once the timeout expires - call from housekeeping_task_user()
+void sl_hold_shift_task(void);
+#else
+static inline bool process_sl_hold_shift(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+static inline void sl_hold_shift_task(void) {}
+#endif
+
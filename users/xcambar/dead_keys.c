@@ -1,5 +1,5 @@
 #include QMK_KEYBOARD_H
-#include "../custom_keycodes.h"
+#include "xcambar.h"  // DK_* keycodes
 #include "dead_keys.h"
 #include "os_control.h"
 
@@ -15,12 +15,11 @@
  * - Data-driven: accent combinations stored in lookup tables
  *
  * Usage in keymap.c:
- * 1. Include this header after custom_keycodes.h
- * 2. Add dead_keys.c to SRC in rules.mk
- * 3. Call process_dead_key() in process_record_user() BEFORE process_semkey()
+ * 1. XC_DEAD_KEYS = yes in the keymap's rules.mk (DK_* keycodes come with xcambar.h)
+ * 2. Call process_dead_key() in process_record_user() BEFORE process_semkey()
  */
 
-// Dead keys list using CUSTOM_KEYCODES macro from custom_keycodes.h
+// Dead keys list using CUSTOM_KEYCODES macro from xcambar.h
 // Expands to: _DEAD_KEYS_START, DK_ACUTE, ..., _DEAD_KEYS_COUNT
 #define DEAD_KEYS_LIST CUSTOM_KEYCODES(DEAD_KEYS, \
         DK_ACUTE, \
@@ -30,9 +29,15 @@
         DK_TILDE \
     )
 
+#ifdef XC_DEAD_KEYS
 // Process dead keys - call from process_record_user() BEFORE process_semkey()
 // Returns true to continue processing, false if handled
 bool process_dead_key(uint16_t keycode, keyrecord_t *record);
+#else
+static inline bool process_dead_key(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+#endif
 
 // Tap the platform-specific dead key (for use in Compose, etc.)
 void tap_deadkey_code(uint16_t dk);
@@ -28,6 +28,13 @@ const char* get_os_platform_name(void) {
     return "Unknown";
 }
 
+// Set the OS platform (ignored if out of range)
+void set_os_platform(uint8_t os) {
+    if (os < _OS_COUNT) {
+        current_os = os;
+    }
+}
+
 // Toggle to the next OS platform (cycles through all supported OSes)
 void toggle_os_platform(void) {
     current_os = (current_os + 1) % _OS_COUNT;
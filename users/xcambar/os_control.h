@@ -23,5 +23,8 @@ uint8_t get_os_platform(void);
 // Get the current OS platform name as a string
 const char* get_os_platform_name(void);
 
+// Set the OS platform (ignored if out of range)
+void set_os_platform(uint8_t os);
+
 // Toggle to the next OS platform (cycles through all supported OSes)
 void toggle_os_platform(void);
@@ -0,0 +1,66 @@
+###################
+# Shared features (see xcambar.h)
+#
+# Every switch defaults to no: keymaps turn on what they use in their own rules.mk,
+# which QMK reads before this file.
+
+XC_OS_CONTROL ?= no
+XC_SEMANTIC_KEYS ?= no
+XC_DEAD_KEYS ?= no
+XC_SWAPPER ?= no
+XC_ALT_BASE_SYMBOLS ?= no
+XC_ALT_SYMBOLS_LAYER ?= no
+XC_SL_HOLD_SHIFT ?= no
+
+###################
+# This manipulates the options
+#
+
+# Semantic keys, dead keys and swappers pick their keystrokes by OS
+ifeq ($(strip $(XC_SEMANTIC_KEYS)), yes)
+    XC_OS_CONTROL = yes
+endif
+ifeq ($(strip $(XC_DEAD_KEYS)), yes)
+    XC_OS_CONTROL = yes
+endif
+ifeq ($(strip $(XC_SWAPPER)), yes)
+    XC_OS_CONTROL = yes
+endif
+
+# Hold-to-shift reads the symbols layer pair table
+ifeq ($(strip $(XC_SL_HOLD_SHIFT)), yes)
+    XC_ALT_SYMBOLS_LAYER = yes
+endif
+
+ifeq ($(strip $(XC_OS_CONTROL)), yes)
+    OPT_DEFS += -DXC_OS_CONTROL
+    SRC += os_control.c
+endif
+
+ifeq ($(strip $(XC_SEMANTIC_KEYS)), yes)
+    OPT_DEFS += -DXC_SEMANTIC_KEYS
+    SRC += semantic_keys.c
+endif
+
+ifeq ($(strip $(XC_DEAD_KEYS)), yes)
+    OPT_DEFS += -DXC_DEAD_KEYS
+    SRC += dead_keys.c
+endif
+
+ifeq ($(strip $(XC_SWAPPER)), yes)
+    OPT_DEFS += -DXC_SWAPPER
+    SRC += swapper.c
+endif
+
+ifeq ($(strip $(XC_ALT_BASE_SYMBOLS)), yes)
+    OPT_DEFS += -DXC_ALT_BASE_SYMBOLS
+endif
+
+ifeq ($(strip $(XC_ALT_SYMBOLS_LAYER)), yes)
+    OPT_DEFS += -DXC_ALT_SYMBOLS_LAYER
+endif
+
+ifeq ($(strip $(XC_SL_HOLD_SHIFT)), yes)
+    OPT_DEFS += -DXC_SL_HOLD_SHIFT
+    SRC += alt_symbols_layer.c
+endif
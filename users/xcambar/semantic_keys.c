@@ -1,5 +1,5 @@
 #include QMK_KEYBOARD_H
-#include "../custom_keycodes.h"  // Must be included before semantic_keys.h
+#include "xcambar.h"  // SK_* keycodes
 #include "semantic_keys.h"
 #include "os_control.h"
 
@@ -10,10 +10,11 @@
  * that automatically send the correct keystroke for Mac or Linux.
  *
  * Supports sequences of keycodes for complex inputs (e.g., dead keys + letter)
+ * and per-application variants (GUI, terminal, browser, editor) selected by the host.
  */
 
 // Maximum number of keycodes in a sequence
-#define MAX_SEMKEY_SEQUENCE 3
+#define MAX_SEMKEY_SEQUENCE 4
 
 // Semantic key data structure: holds platform-specific keycode sequences
 // Sequences are terminated by KC_NO
@@ -29,45 +30,73 @@ typedef struct {
 #define SK_ndx(sk) ((sk) - SK_beg)
 #define is_SemKey(sk) (((sk) >= (uint16_t)(SK_beg)) && ((sk) < (uint16_t)(SK_end)))
 
-// Lookup table for semantic keys by platform
+// Lookup tables for semantic keys by app context and platform
 // Using designated initializers (C99) for clarity - order doesn't matter!
-// Format: [SK_ndx(keycode)] = {{mac_seq}, {linux_seq}}
-// Sequences terminated by KC_NO
-static const semkey_map_t semkey_table[SK_count] = {
-    [SK_ndx(SK_UNDO)]   = {{G(KC_Z), KC_NO},              {C(KC_Z), KC_NO}},                    // Undo
-
-    [SK_ndx(SK_CUT)]    = {{G(KC_X), KC_NO},              {C(KC_X), KC_NO}},                    // Cut
-    [SK_ndx(SK_COPY)]   = {{G(KC_C), KC_NO},              {C(KC_C), KC_NO}},                    // Copy
-    [SK_ndx(SK_PSTE)]   = {{G(KC_V), KC_NO},              {C(KC_V), KC_NO}},                    // Paste
-
-    [SK_ndx(SK_SALL)]   = {{G(KC_A), KC_NO},              {C(KC_A), KC_NO}},                    // Select All
-
-    [SK_ndx(SK_EURO)]   = {{LALT(S(KC_2)), KC_NO},        {RALT(KC_EQL), KC_E, KC_NO}},         // Euro (€): Mac: Opt+Shift+2 | Linux: AltGr+=, E
-    [SK_ndx(SK_CEDIL)]  = {{LALT(KC_C), KC_NO},           {RALT(KC_COMMA), KC_C, KC_NO}},       // Cedilla (ç): Mac: Opt+C | Linux: AltGr+,, C
-    [SK_ndx(SK_NTILDE)] = {{LALT(KC_N), KC_N, KC_NO},     {RALT(LSFT(KC_GRV)), KC_N, KC_NO}},           // Ñ: Mac: Opt+N, N | Linux: AltGr+N, N
-
-    // Navigation keys - taken from HandsDown
-    // https://github.com/moutis/HandsDown/blob/ac766b44b1454d72b395ee460bcae9f6fe89a700/moutis_semantickeys.c
-    [SK_ndx(SK_WORDPRV)] = {{LALT(KC_LEFT), KC_NO},       {C(KC_LEFT), KC_NO}},      // WORD LEFT
-    [SK_ndx(SK_WORDNXT)] = {{LALT(KC_RIGHT), KC_NO},      {C(KC_RIGHT), KC_NO}},     // WORD RIGHT
-    [SK_ndx(SK_DOCBEG)]  = {{G(KC_UP), KC_NO},            {C(KC_HOME), KC_NO}},      // Go to start of document
-    [SK_ndx(SK_DOCEND)]  = {{G(KC_DOWN), KC_NO},          {C(KC_END), KC_NO}},       // Go to end of document
-    [SK_ndx(SK_LINEBEG)] = {{G(KC_LEFT), KC_NO},          {KC_HOME, KC_NO}},         // Go to beginning of line
-    [SK_ndx(SK_LINEEND)] = {{G(KC_RIGHT), KC_NO},         {KC_END, KC_NO}},          // Go to end of line
-
-    // Deletion keys (NAV_DEL sub-layer)
-    // Line deletions are GUI-tuned; shells use their own bindings (Ctrl-U / Ctrl-K)
-    [SK_ndx(SK_DELWORDPRV)] = {{LALT(KC_BSPC), KC_NO},    {C(KC_BSPC), KC_NO}},          // Delete word backward
-    [SK_ndx(SK_DELWORDNXT)] = {{LALT(KC_DEL), KC_NO},     {C(KC_DEL), KC_NO}},           // Delete word forward
-    [SK_ndx(SK_DELLINEBEG)] = {{G(KC_BSPC), KC_NO},       {S(KC_HOME), KC_BSPC, KC_NO}}, // Delete to line beginning
-    [SK_ndx(SK_DELLINEEND)] = {{C(KC_K), KC_NO},          {S(KC_END), KC_BSPC, KC_NO}},  // Delete to line end
-
-    // Add Warpd later...
-
-    // [SK_ndx(SK_HISTPRV)] = {{G(KC_LBRC), KC_NO},          {LALT(KC_LEFT), KC_NO}},   // BROWSER BACK
-    // [SK_ndx(SK_HISTNXT)] = {{G(KC_RBRC), KC_NO},          {LALT(KC_RIGHT), KC_NO}},  // BROWSER FWD
+// The GUI table is complete; the other contexts only list what differs from it, every
+// entry initialized once. Entries left out are all KC_NO and fall back to the GUI table.
+static const semkey_map_t semkey_gui_table[SK_count] = {
+#include "semantic_keys_gui.h"
 };
 
+static const semkey_map_t semkey_context_table[_SK_CTX_COUNT][SK_count] = {
+    // Terminals: clipboard needs Shift on Linux, editing goes through readline/zle
+    [SK_CTX_TERMINAL] = {
+        [SK_ndx(SK_UNDO)]       = {{C(S(KC_MINS)), KC_NO},  {C(S(KC_MINS)), KC_NO}},   // Undo: readline Ctrl-_
+        [SK_ndx(SK_CUT)]        = {{G(KC_C), KC_NO},        {C(S(KC_C)), KC_NO}},      // Cut: terminals only copy
+        [SK_ndx(SK_COPY)]       = {{G(KC_C), KC_NO},        {C(S(KC_C)), KC_NO}},      // Copy (Ctrl-C would interrupt)
+        [SK_ndx(SK_PSTE)]       = {{G(KC_V), KC_NO},        {C(S(KC_V)), KC_NO}},      // Paste
+        [SK_ndx(SK_WORDPRV)]    = {{LALT(KC_B), KC_NO},     {LALT(KC_B), KC_NO}},      // Word left: Meta-B
+        [SK_ndx(SK_WORDNXT)]    = {{LALT(KC_F), KC_NO},     {LALT(KC_F), KC_NO}},      // Word right: Meta-F
+        [SK_ndx(SK_LINEBEG)]    = {{C(KC_A), KC_NO},        {C(KC_A), KC_NO}},         // Beginning of line: Ctrl-A
+        [SK_ndx(SK_LINEEND)]    = {{C(KC_E), KC_NO},        {C(KC_E), KC_NO}},         // End of line: Ctrl-E
+        [SK_ndx(SK_DELWORDPRV)] = {{C(KC_W), KC_NO},        {C(KC_W), KC_NO}},         // Delete word backward: Ctrl-W
+        [SK_ndx(SK_DELWORDNXT)] = {{LALT(KC_D), KC_NO},     {LALT(KC_D), KC_NO}},      // Delete word forward: Meta-D
+        [SK_ndx(SK_DELLINEBEG)] = {{C(KC_U), KC_NO},        {C(KC_U), KC_NO}},         // Delete to line beginning: Ctrl-U
+        [SK_ndx(SK_DELLINEEND)] = {{C(KC_K), KC_NO},        {C(KC_K), KC_NO}},         // Delete to line end: Ctrl-K
+    },
+
+    // Browsers: page-level document motions (text fields keep the GUI line bindings)
+    [SK_CTX_BROWSER] = {
+        [SK_ndx(SK_DOCBEG)]     = {{G(KC_UP), KC_NO},       {KC_HOME, KC_NO}},         // Top of page
+        [SK_ndx(SK_DOCEND)]     = {{G(KC_DOWN), KC_NO},     {KC_END, KC_NO}},          // Bottom of page
+    },
+
+    // Code editors: select-then-delete so line deletions work regardless of keymap
+    [SK_CTX_EDITOR] = {
+        [SK_ndx(SK_DELLINEBEG)] = {{G(S(KC_LEFT)), KC_BSPC, KC_NO},  {S(KC_HOME), KC_BSPC, KC_NO}}, // Delete to line beginning
+        [SK_ndx(SK_DELLINEEND)] = {{G(S(KC_RIGHT)), KC_BSPC, KC_NO}, {S(KC_END), KC_BSPC, KC_NO}},  // Delete to line end
+        [SK_ndx(SK_SELWORD)]    = {{G(KC_D), KC_NO},        {C(KC_D), KC_NO}},         // Select word (again: next occurrence)
+        [SK_ndx(SK_SELLINE)]    = {{G(KC_L), KC_NO},        {C(KC_L), KC_NO}},         // Select line (again: next line)
+    },
+};
+
+// Active app context (set by the host, see host_link.c)
+static uint8_t semkey_context = SK_CTX_GUI;
+
+// Entry of the active context, or the GUI one where the context doesn't differ
+static const semkey_map_t *semkey_entry(uint16_t idx) {
+    const semkey_map_t *entry = &semkey_context_table[semkey_context][idx];
+    if (entry->mac_sequence[0] == KC_NO && entry->linux_sequence[0] == KC_NO) {
+        entry = &semkey_gui_table[idx];
+    }
+    return entry;
+}
+
+void set_semkey_context(uint8_t context) {
+    if (context < _SK_CTX_COUNT) {
+        semkey_context = context;
+    }
+}
+
+uint8_t get_semkey_context(void) {
+    return semkey_context;
+}
+
+// Check whether a keycode is a semantic key (public function)
+bool is_semkey(uint16_t keycode) {
+    return is_SemKey(keycode);
+}
+
 // Tap a sequence of keycodes for a semantic key (public function)
 void tap_semkey_code(uint16_t sk) {
     if (!is_SemKey(sk)) {
@@ -79,7 +108,7 @@ void tap_semkey_code(uint16_t sk) {
         return;
     }
 
-    const semkey_map_t *entry = &semkey_table[idx];
+    const semkey_map_t *entry = semkey_entry(idx);
     const uint16_t *sequence = (get_os_platform() == OS_MacOS) ? entry->mac_sequence : entry->linux_sequence;
 
     // Tap each keycode in the sequence until we hit KC_NO
@@ -100,7 +129,7 @@ uint16_t get_semkey_code(uint16_t sk) {
         return KC_NO;
     }
 
-    const semkey_map_t *entry = &semkey_table[idx];
+    const semkey_map_t *entry = semkey_entry(idx);
     const uint16_t *sequence = (get_os_platform() == OS_MacOS) ? entry->mac_sequence : entry->linux_sequence;
 
     // Return first keycode if it's the only one, otherwise KC_NO (use tap_semkey_code instead)
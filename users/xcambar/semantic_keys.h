@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "quantum.h"
+
+/*
+ * Semantic Keys - Platform Independence Layer
+ *
+ * This implementation provides platform-independent editing commands
+ * that automatically send the correct keystroke for Mac or Linux.
+ *
+ * Design goals:
+ * - Data-driven: keycodes stored in lookup table by platform
+ * - Proper C file structure (no static variables in headers)
+ *
+ * Usage in keymap.c:
+ * 1. XC_SEMANTIC_KEYS = yes in the keymap's rules.mk (SK_* keycodes come with xcambar.h)
+ * 2. Call process_semkey() in process_record_user()
+ */
+
+// Semantic keys list using CUSTOM_KEYCODES macro from xcambar.h
+// Expands to: SK_UNDO = _SEMANTIC_KEYS_START, SK_CUT, ..., _SEMANTIC_KEYS_COUNT
+#define SEMANTIC_KEYS_LIST   CUSTOM_KEYCODES(SEMANTIC_KEYS, \
+        SK_UNDO, \
+        SK_CUT, \
+        SK_COPY, \
+        SK_PSTE, \
+        SK_SALL, \
+        SK_EURO, \
+        SK_CEDIL, \
+        SK_NTILDE, \
+        SK_WORDPRV, \
+        SK_WORDNXT, \
+        SK_DOCBEG, \
+        SK_DOCEND, \
+        SK_LINEBEG, \
+        SK_LINEEND, \
+        SK_DELWORDPRV, \
+        SK_DELWORDNXT, \
+        SK_DELLINEBEG, \
+        SK_DELLINEEND, \
+        SK_SELWORD, \
+        SK_SELLINE, \
+        SK_SELPARA \
+    )
+
+// Application contexts: each has its own sequences (e.g. Ctrl-U / Ctrl-K in terminals)
+typedef enum {
+    SK_CTX_GUI = 0,
+    SK_CTX_TERMINAL,
+    SK_CTX_BROWSER,
+    SK_CTX_EDITOR,
+    _SK_CTX_COUNT  // Total number of app contexts
+} semkey_context_t;
+
+#ifdef XC_SEMANTIC_KEYS
+// Select the app context used by every semantic key (out-of-range values are ignored)
+void set_semkey_context(uint8_t context);
+
+// Get the active app context
+uint8_t get_semkey_context(void);
+
+// Process semantic keys - call from process_record_user()
+// Returns true to continue processing, false if handled
+bool process_semkey(uint16_t keycode, keyrecord_t *record);
+
+// Check whether a keycode is a semantic key (e.g. to replay it through the output queue)
+bool is_semkey(uint16_t keycode);
+
+// Tap the platform-specific keycode sequence for a semantic key (for use in Compose, etc.)
+void tap_semkey_code(uint16_t sk);
+#else
+static inline void set_semkey_context(uint8_t context) {}
+static inline uint8_t get_semkey_context(void) {
+    return SK_CTX_GUI;
+}
+static inline bool process_semkey(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+static inline bool is_semkey(uint16_t keycode) {
+    return false;
+}
+static inline void tap_semkey_code(uint16_t sk) {}
+#endif
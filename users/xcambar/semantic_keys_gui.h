@@ -0,0 +1,43 @@
+// Semantic key sequences for GUI applications - the body of semkey_gui_table
+// (semantic_keys.c). Other app contexts override the few entries that differ.
+// Format: [SK_ndx(keycode)] = {{mac_seq}, {linux_seq}}
+// Sequences terminated by KC_NO
+
+    [SK_ndx(SK_UNDO)]   = {{G(KC_Z), KC_NO},              {C(KC_Z), KC_NO}},                    // Undo
+
+    [SK_ndx(SK_CUT)]    = {{G(KC_X), KC_NO},              {C(KC_X), KC_NO}},                    // Cut
+    [SK_ndx(SK_COPY)]   = {{G(KC_C), KC_NO},              {C(KC_C), KC_NO}},                    // Copy
+    [SK_ndx(SK_PSTE)]   = {{G(KC_V), KC_NO},              {C(KC_V), KC_NO}},                    // Paste
+
+    [SK_ndx(SK_SALL)]   = {{G(KC_A), KC_NO},              {C(KC_A), KC_NO}},                    // Select All
+
+    [SK_ndx(SK_EURO)]   = {{LALT(S(KC_2)), KC_NO},        {RALT(KC_EQL), KC_E, KC_NO}},         // Euro (€): Mac: Opt+Shift+2 | Linux: AltGr+=, E
+    [SK_ndx(SK_CEDIL)]  = {{LALT(KC_C), KC_NO},           {RALT(KC_COMMA), KC_C, KC_NO}},       // Cedilla (ç): Mac: Opt+C | Linux: AltGr+,, C
+    [SK_ndx(SK_NTILDE)] = {{LALT(KC_N), KC_N, KC_NO},     {RALT(LSFT(KC_GRV)), KC_N, KC_NO}},           // Ñ: Mac: Opt+N, N | Linux: AltGr+N, N
+
+    // Navigation keys - taken from HandsDown
+    // https://github.com/moutis/HandsDown/blob/ac766b44b1454d72b395ee460bcae9f6fe89a700/moutis_semantickeys.c
+    [SK_ndx(SK_WORDPRV)] = {{LALT(KC_LEFT), KC_NO},       {C(KC_LEFT), KC_NO}},      // WORD LEFT
+    [SK_ndx(SK_WORDNXT)] = {{LALT(KC_RIGHT), KC_NO},      {C(KC_RIGHT), KC_NO}},     // WORD RIGHT
+    [SK_ndx(SK_DOCBEG)]  = {{G(KC_UP), KC_NO},            {C(KC_HOME), KC_NO}},      // Go to start of document
+    [SK_ndx(SK_DOCEND)]  = {{G(KC_DOWN), KC_NO},          {C(KC_END), KC_NO}},       // Go to end of document
+    [SK_ndx(SK_LINEBEG)] = {{G(KC_LEFT), KC_NO},          {KC_HOME, KC_NO}},         // Go to beginning of line
+    [SK_ndx(SK_LINEEND)] = {{G(KC_RIGHT), KC_NO},         {KC_END, KC_NO}},          // Go to end of line
+
+    // Deletion keys (NAV_DEL sub-layer)
+    // Line deletions are GUI-tuned; the terminal context uses the shell bindings (Ctrl-U / Ctrl-K)
+    [SK_ndx(SK_DELWORDPRV)] = {{LALT(KC_BSPC), KC_NO},    {C(KC_BSPC), KC_NO}},          // Delete word backward
+    [SK_ndx(SK_DELWORDNXT)] = {{LALT(KC_DEL), KC_NO},     {C(KC_DEL), KC_NO}},           // Delete word forward
+    [SK_ndx(SK_DELLINEBEG)] = {{G(KC_BSPC), KC_NO},       {S(KC_HOME), KC_BSPC, KC_NO}}, // Delete to line beginning
+    [SK_ndx(SK_DELLINEEND)] = {{C(KC_K), KC_NO},          {S(KC_END), KC_BSPC, KC_NO}},  // Delete to line end
+
+    // Selections: move to the end of the unit, back to its start, then select to its end
+    // (works from anywhere inside it). Sent without modifiers, see the select latch in keymap.c
+    [SK_ndx(SK_SELWORD)] = {{LALT(KC_RIGHT), LALT(KC_LEFT), LALT(S(KC_RIGHT)), KC_NO}, {C(KC_RIGHT), C(KC_LEFT), C(S(KC_RIGHT)), KC_NO}}, // Select word
+    [SK_ndx(SK_SELLINE)] = {{G(KC_LEFT), G(S(KC_RIGHT)), KC_NO},                       {KC_HOME, S(KC_END), KC_NO}},                       // Select line
+    [SK_ndx(SK_SELPARA)] = {{LALT(KC_DOWN), LALT(KC_UP), LALT(S(KC_DOWN)), KC_NO},     {C(KC_DOWN), C(KC_UP), C(S(KC_DOWN)), KC_NO}},      // Select paragraph
+
+    // Add Warpd later...
+
+    // [SK_ndx(SK_HISTPRV)] = {{G(KC_LBRC), KC_NO},          {LALT(KC_LEFT), KC_NO}},   // BROWSER BACK
+    // [SK_ndx(SK_HISTNXT)] = {{G(KC_RBRC), KC_NO},          {LALT(KC_RIGHT), KC_NO}},  // BROWSER FWD
@@ -0,0 +1,83 @@
+#include "swapper.h"
+#include "os_control.h"
+
+__attribute__((weak)) bool is_swapper_ignored_key(uint16_t keycode) {
+    return false;
+}
+
+// Class of a key, matched against each swapper's ignore mask
+static uint8_t swapper_key_class(uint16_t keycode) {
+    switch (keycode) {
+        case KC_LSFT:
+        case KC_RSFT:
+            return SWAPPER_IGNORE_SHIFT;
+        case KC_RGHT:
+        case KC_LEFT:
+        case KC_DOWN:
+        case KC_UP:
+            return SWAPPER_IGNORE_ARROWS;
+        case QK_MOMENTARY ... QK_MOMENTARY_MAX:
+            return SWAPPER_IGNORE_LAYER;
+        default:
+            return is_swapper_ignored_key(keycode) ? SWAPPER_IGNORE_USER : 0;
+    }
+}
+
+static void swapper_release(swapper_t *sw) {
+    unregister_code(sw->held_mod);
+    sw->held_mod = KC_NO;
+}
+
+bool process_swappers(uint16_t keycode, keyrecord_t *record) {
+    bool    handled   = false;
+    uint8_t key_class = 0;
+    bool    classed   = false;
+
+    for (uint8_t i = 0; i < swapper_count; i++) {
+        swapper_t *sw = &swappers[i];
+        if (keycode == sw->trigger) {
+            if (record->event.pressed) {
+                if (sw->held_mod == KC_NO) {
+                    sw->held_mod = get_os_platform() == OS_MacOS ? sw->mac_mod : sw->linux_mod;
+                    register_code(sw->held_mod);
+                }
+                // Shift is already registered by oneshot or held key, just tap tabish
+                register_code(sw->tab);
+            } else {
+                unregister_code(sw->tab);
+                // Don't unregister cmdish until some other key is hit or released.
+            }
+            sw->pressed   = record->event.pressed;
+            sw->last_time = timer_read();
+            handled       = true;
+        } else if (sw->held_mod != KC_NO) {
+            // Don't deactivate if it's an ignored key (e.g., shift for direction change)
+            if (!classed) {
+                key_class = swapper_key_class(keycode);
+                classed   = true;
+            }
+            if (!(key_class & sw->ignore)) {
+                swapper_release(sw);
+            }
+        }
+    }
+    return !handled;
+}
+
+void swapper_task(void) {
+    for (uint8_t i = 0; i < swapper_count; i++) {
+        swapper_t *sw = &swappers[i];
+        if (sw->held_mod != KC_NO && sw->timeout && !sw->pressed && timer_elapsed(sw->last_time) >= sw->timeout) {
+            swapper_release(sw);
+        }
+    }
+}
+
+bool is_swapper_active(void) {
+    for (uint8_t i = 0; i < swapper_count; i++) {
+        if (swappers[i].held_mod != KC_NO) {
+            return true;
+        }
+    }
+    return false;
+}
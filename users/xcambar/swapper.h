@@ -0,0 +1,82 @@
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+// Implements cmd-tab like behaviour on a single key. On first tap of trigger
+// cmdish is held and tabish is tapped -- cmdish then remains held until some
+// other key is hit or released. For example:
+//
+//     trigger, trigger, a -> cmd down, tab, tab, cmd up, a
+//     nav down, trigger, nav up -> nav down, cmd down, tab, cmd up, nav up
+//
+// If Shift is held while trigger is pressed, sends Shift+Tab for reverse direction.
+//
+// This behaviour is useful for more than just cmd-tab, hence: cmdish, tabish.
+//
+// Several swappers can be live at once (windows, tabs, windows of the same app...):
+// each one is a row of the consumer's swappers[] table. Its cmdish is picked through
+// os_control when the swap starts (e.g. GUI on macOS, Alt on Linux), it can let go
+// of cmdish after an idle timeout, and it keeps going through the keys whose class
+// is in its ignore mask. Triggering one swapper ends any other.
+//
+// Usage:
+// 1. XC_SWAPPER = yes in the keymap's rules.mk
+// 2. Define swappers[] with SWAPPER() rows, and swapper_count
+// 3. Call process_swappers() from process_record_user() and swapper_task() from
+//    housekeeping_task_user()
+
+#ifndef SWAPPER_IDLE_TIMEOUT
+#    define SWAPPER_IDLE_TIMEOUT 1000  // ms, suggested timeout for SWAPPER() rows
+#endif
+
+// Key classes that don't end a swap (ignore mask of a swapper)
+enum swapper_ignore {
+    SWAPPER_IGNORE_SHIFT  = 1 << 0,  // Shift, to reverse direction
+    SWAPPER_IGNORE_ARROWS = 1 << 1,  // arrows, to move in the switcher
+    SWAPPER_IGNORE_LAYER  = 1 << 2,  // momentary layer keys
+    SWAPPER_IGNORE_USER   = 1 << 3,  // keys is_swapper_ignored_key() returns true for
+};
+
+typedef struct {
+    uint16_t trigger;
+    uint8_t  mac_mod;    // cmdish on macOS
+    uint8_t  linux_mod;  // cmdish on Linux
+    uint8_t  tab;        // tabish
+    uint8_t  ignore;     // swapper_ignore mask
+    uint16_t timeout;    // ms without a trigger press before cmdish is released, 0 = never
+    // State
+    uint8_t  held_mod;   // cmdish while swapping, KC_NO otherwise
+    bool     pressed;    // trigger is down
+    uint16_t last_time;  // last trigger event
+} swapper_t;
+
+#define SWAPPER(trigger, mac_mod, linux_mod, tab, ignore, timeout) \
+    { trigger, mac_mod, linux_mod, tab, ignore, timeout, KC_NO, false, 0 }
+
+// To be implemented by the consumer: the swappers
+extern swapper_t     swappers[];
+extern const uint8_t swapper_count;
+
+// To be implemented by the consumer (optional). Defines keys that should not
+// interrupt swappers with SWAPPER_IGNORE_USER (e.g., a latched Shift).
+bool is_swapper_ignored_key(uint16_t keycode);
+
+#ifdef XC_SWAPPER
+// Process swapper triggers - call from process_record_user()
+// Returns false when the key was a trigger (handled)
+bool process_swappers(uint16_t keycode, keyrecord_t *record);
+
+// Release idle swappers - call from housekeeping_task_user()
+void swapper_task(void);
+
+// True while any swapper holds its cmdish
+bool is_swapper_active(void);
+#else
+static inline bool process_swappers(uint16_t keycode, keyrecord_t *record) {
+    return true;
+}
+static inline void swapper_task(void) {}
+static inline bool is_swapper_active(void) {
+    return false;
+}
+#endif
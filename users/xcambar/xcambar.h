@@ -0,0 +1,78 @@
+#pragma once
+
+#include "quantum.h"
+
+/*
+ * xcambar - Shared userspace features
+ *
+ * Features shared by the keymaps of this userspace. A keymap opts in with
+ * USER_NAME := xcambar and one switch per feature in its rules.mk; this directory's
+ * rules.mk (read after the keymap's) turns the switches into sources and defines.
+ * Every switch defaults to no, and a feature that is off costs nothing: its source
+ * is not built, its keycodes are left out of the enum below, and its process hook
+ * is an empty inline the compiler drops from process_record_user().
+ *
+ * Switches:
+ * - XC_OS_CONTROL         OS platform tracking (os_control.h)
+ * - XC_SEMANTIC_KEYS      platform-aware editing keys, SK_* (semantic_keys.h), with XC_OS_CONTROL
+ * - XC_DEAD_KEYS          OS dead key triggers, DK_* (dead_keys.h), with XC_OS_CONTROL
+ * - XC_SWAPPER            cmd-tab style window and tab switching (swapper.h), with XC_OS_CONTROL
+ * - XC_ALT_BASE_SYMBOLS   AS_* shift pairs for the base layer (alt_symbols.h)
+ * - XC_ALT_SYMBOLS_LAYER  SL_* shift pairs for the symbols layer (alt_symbols_layer.h)
+ * - XC_SL_HOLD_SHIFT      hold an SL_* key to type its shifted partner, with XC_ALT_SYMBOLS_LAYER
+ *
+ * Usage in keymap.c:
+ * 1. Include this header instead of the feature headers
+ * 2. Start the keymap's own keycodes at XC_SAFE_RANGE instead of SAFE_RANGE
+ */
+
+// Token concatenation helper macros for custom keycodes
+#define X_CONCAT_IMPL(a, b) a ## b
+#define X_CONCAT(a, b) X_CONCAT_IMPL(a, b)
+
+#define LIST_START_MARKER(PREFIX) X_CONCAT(X_CONCAT(_, PREFIX), _START)
+#define LIST_LENGTH(PREFIX) X_CONCAT(X_CONCAT(_, PREFIX), _COUNT)
+
+#define CUSTOM_KEYCODES(PREFIX, ...) \
+    LIST_START_MARKER(PREFIX), \
+    X_FIRST(__VA_ARGS__), \
+    X_REST(__VA_ARGS__), \
+    LIST_LENGTH(PREFIX)
+
+// Helper macros to extract first and rest of arguments
+#define X_FIRST(first, ...) first
+#define X_REST(first, ...) __VA_ARGS__
+
+#include "os_control.h"
+#include "swapper.h"
+#include "semantic_keys.h"
+#include "dead_keys.h"
+#include "alt_symbols.h"
+#include "alt_symbols_layer.h"
+
+// Keycodes of the enabled features; keymaps continue from XC_SAFE_RANGE
+enum xcambar_keycodes {
+    _XC_KEYCODES_BEFORE = SAFE_RANGE - 1,
+
+#ifdef XC_SEMANTIC_KEYS
+    // Semantic keys (expanded from SEMANTIC_KEYS_LIST macro)
+    SEMANTIC_KEYS_LIST,
+#endif
+
+#ifdef XC_DEAD_KEYS
+    // Dead keys (expanded from DEAD_KEYS_LIST macro)
+    DEAD_KEYS_LIST,
+#endif
+
+#ifdef XC_ALT_BASE_SYMBOLS
+    // Alternative symbols (expanded from ALT_SYMBOLS_LIST macro)
+    ALT_SYMBOLS_LIST,
+#endif
+
+#ifdef XC_ALT_SYMBOLS_LAYER
+    // Alternative symbols layer (expanded from ALT_SYMBOLS_LAYER_LIST macro)
+    ALT_SYMBOLS_LAYER_LIST,
+#endif
+
+    XC_SAFE_RANGE
+};